@@ -0,0 +1,71 @@
+#include "duckdb/execution/adaptive_transfer_filter.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+AdaptiveTransferFilter::AdaptiveTransferFilter(idx_t filter_count) : stats(filter_count), chunk_count(0) {
+	for (idx_t idx = 0; idx < filter_count; idx++) {
+		permutation.push_back(idx);
+	}
+}
+
+void AdaptiveTransferFilter::Update(idx_t idx, idx_t rows_in, idx_t rows_out, double duration) {
+	auto &filter_stats = stats[idx];
+	filter_stats.rows_in += rows_in;
+	filter_stats.rows_out += rows_out;
+	filter_stats.runtime += duration;
+}
+
+double AdaptiveTransferFilter::Rank(const FilterStatistics &filter_stats) const {
+	D_ASSERT(filter_stats.rows_in > 0);
+	auto cost_per_tuple = filter_stats.runtime / filter_stats.rows_in;
+	auto removed_fraction = 1.0 - double(filter_stats.rows_out) / filter_stats.rows_in;
+	if (removed_fraction <= 0) {
+		return NumericLimits<double>::Maximum();
+	}
+	return cost_per_tuple / removed_fraction;
+}
+
+void AdaptiveTransferFilter::AdaptRuntimeStatistics() {
+	if (++chunk_count < ADAPT_INTERVAL) {
+		return;
+	}
+	chunk_count = 0;
+
+	for (auto &filter_stats : stats) {
+		if (!filter_stats.disabled && filter_stats.rows_in >= DISABLE_MIN_ROWS &&
+		    double(filter_stats.rows_out) > DISABLE_PASS_RATE * filter_stats.rows_in) {
+			filter_stats.disabled = true;
+		}
+	}
+
+	// filters that have not seen any rows yet (e.g. everything was filtered before them) have no rank:
+	// they keep their position, and only the observed filters are reordered among the remaining positions
+	vector<idx_t> positions;
+	vector<idx_t> observed;
+	vector<double> ranks(stats.size(), 0);
+	for (idx_t pos = 0; pos < permutation.size(); pos++) {
+		auto &filter_stats = stats[permutation[pos]];
+		if (filter_stats.rows_in == 0) {
+			continue;
+		}
+		positions.push_back(pos);
+		observed.push_back(permutation[pos]);
+		ranks[permutation[pos]] = Rank(filter_stats);
+	}
+	std::stable_sort(observed.begin(), observed.end(),
+	                 [&](idx_t left, idx_t right) { return ranks[left] < ranks[right]; });
+	for (idx_t i = 0; i < positions.size(); i++) {
+		permutation[positions[i]] = observed[i];
+	}
+
+	// halve the statistics so that the order follows changes in the data
+	for (auto &filter_stats : stats) {
+		filter_stats.rows_in /= 2;
+		filter_stats.rows_out /= 2;
+		filter_stats.runtime /= 2;
+	}
+}
+
+} // namespace duckdb
@@ -133,7 +133,16 @@ void ColumnBindingResolver::VisitOperator(LogicalOperator &op) {
 	case LogicalOperatorType::LOGICAL_CREATE_BF: {
 		VisitOperatorChildren(op);
 		auto &create_bf = op.Cast<LogicalCreateBF>();
+		// expression keys are evaluated into columns appended to the input, in filter order
+		idx_t key_column = bindings.size();
 		for (auto &bf : create_bf.bf_to_create) {
+			if (!bf->expressions_built_.empty()) {
+				for (auto &expr : bf->expressions_built_) {
+					VisitExpression(&expr);
+					bf->BoundColsBuilt.emplace_back(key_column++);
+				}
+				continue;
+			}
 			for(auto &colbind : bf->GetColBuilt()) {
 				for (idx_t i = 0; i < bindings.size(); i++) {
 					if (colbind == bindings[i]) {
@@ -152,7 +161,25 @@ void ColumnBindingResolver::VisitOperator(LogicalOperator &op) {
 	case LogicalOperatorType::LOGICAL_USE_BF: {
 		VisitOperatorChildren(op);
 		auto &use_bf = op.Cast<LogicalUseBF>();
+		idx_t key_column = bindings.size();
 		for (auto bf : use_bf.bf_to_use) {
+			if (use_bf.set_operation_index != DConstants::INVALID_INDEX) {
+				// all branches of the set operation share the filter and bind its columns to the same positions
+				if (bf->BoundColsApplied.empty()) {
+					for (auto &colbind : bf->GetColApplied()) {
+						D_ASSERT(colbind.table_index == use_bf.set_operation_index);
+						bf->BoundColsApplied.emplace_back(colbind.column_index);
+					}
+				}
+				continue;
+			}
+			if (!bf->expressions_applied_.empty()) {
+				for (auto &expr : bf->expressions_applied_) {
+					VisitExpression(&expr);
+					bf->BoundColsApplied.emplace_back(key_column++);
+				}
+				continue;
+			}
 			for (auto& colbind : bf->GetColApplied()) {
 				for (idx_t i = 0; i < bindings.size(); i++) {
 					if (colbind == bindings[i]) {
@@ -86,32 +86,19 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
-}
-
 void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
 	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
 	for (idx_t i = 0; i < count; i++) {
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		// the address of the entry leaves the upper bits free for the salt the entry is checked against
+		result_data[rindex] = PrependEntry(data_ptr_cast(main_ht + (hash & bitmask)), nullptr, HashSalt(hash));
 	}
 }
 
@@ -144,7 +131,8 @@ static idx_t FilterNullValues(UnifiedVectorFormat &vdata, const SelectionVector
 	return result_count;
 }
 
-void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChunk &keys, DataChunk &payload) {
+void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChunk &keys, DataChunk &payload,
+                          Vector *precomputed_hashes) {
 	D_ASSERT(!finalized);
 	D_ASSERT(keys.size() == payload.size());
 	if (keys.size() == 0) {
@@ -209,7 +197,11 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 
 	// hash the keys and obtain an entry in the list
 	// note that we only hash the keys used in the equality comparison
-	Hash(keys, *current_sel, added_count, hash_values);
+	if (precomputed_hashes) {
+		hash_values.Reference(*precomputed_hashes);
+	} else {
+		Hash(keys, *current_sel, added_count, hash_values);
+	}
 
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
@@ -244,22 +236,27 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                    const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
+		const auto index = hashes[i] & bitmask;
+		const auto salt = JoinHashTable::HashSalt(hashes[i]);
 		if (PARALLEL) {
-			data_ptr_t head;
+			// the salt and the pointer are swapped in together, no row of the chain can lose its salt bit
+			data_ptr_t entry;
 			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
+				entry = pointers[index];
+				Store<data_ptr_t>(JoinHashTable::EntryPointer(entry), key_locations[i] + pointer_offset);
+			} while (!std::atomic_compare_exchange_weak(&pointers[index], &entry,
+			                                            JoinHashTable::PrependEntry(key_locations[i], entry, salt)));
 		} else {
+			data_ptr_t entry = pointers[index];
 			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
+			Store<data_ptr_t>(JoinHashTable::EntryPointer(entry), key_locations[i] + pointer_offset);
 
 			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+			pointers[index] = JoinHashTable::PrependEntry(key_locations[i], entry, salt);
 		}
 	}
 }
@@ -267,19 +264,17 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
 
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
 	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	// the full hashes: the bitmask selects the entry, the top bits the salt
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(pointers, hash_data, count, key_locations, pointer_offset, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(pointers, hash_data, count, key_locations, pointer_offset, bitmask);
 	}
 }
 
@@ -451,6 +446,13 @@ idx_t ScanStructure::ScanInnerJoin(DataChunk &keys, SelectionVector &result_vect
 	}
 }
 
+//! Start loading the cache line at `ptr`, which is read a little later
+static inline void PrefetchHashTableEntry(const_data_ptr_t ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr);
+#endif
+}
+
 void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count) {
 	// now for all the pointers, we move on to the next set of pointers
 	idx_t new_count = 0;
@@ -459,6 +461,8 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			// the next rows of the chains are compared once all pointers have moved on
+			PrefetchHashTableEntry(ptrs[idx]);
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -469,10 +473,20 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	idx_t non_empty_count = 0;
 	auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
 	auto cnt = count;
+	// the lookups of a chunk are independent, so their cache misses can overlap: the pointer table entries are
+	// prefetched a few rows ahead of loading them, and the rows they point to as soon as they are loaded, so that
+	// they are cached by the time the keys are compared
+	const auto distance = JoinHashTable::PROBE_PREFETCH_DISTANCE;
 	for (idx_t i = 0; i < cnt; i++) {
+		if (i + distance < cnt) {
+			PrefetchHashTableEntry(JoinHashTable::EntryPointer(ptrs[current_sel->get_index(i + distance)]));
+		}
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
+		// ptrs[idx] is the address of the entry tagged with the salt of the probe key
+		const auto entry = Load<data_ptr_t>(JoinHashTable::EntryPointer(ptrs[idx]));
+		ptrs[idx] = JoinHashTable::SaltMatches(entry, ptrs[idx]) ? JoinHashTable::EntryPointer(entry) : nullptr;
 		if (ptrs[idx]) {
+			PrefetchHashTableEntry(ptrs[idx]);
 			sel_vector.set_index(non_empty_count++, idx);
 		}
 	}
@@ -1024,10 +1038,14 @@ static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk
 unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDataChunkState &key_state,
                                                        DataChunk &payload, ProbeSpill &probe_spill,
                                                        ProbeSpillLocalAppendState &spill_state,
-                                                       DataChunk &spill_chunk) {
+                                                       DataChunk &spill_chunk, Vector *precomputed_hashes) {
 	// hash all the keys
 	Vector hashes(LogicalType::HASH);
-	Hash(keys, *FlatVector::IncrementalSelectionVector(), keys.size(), hashes);
+	if (precomputed_hashes) {
+		hashes.Reference(*precomputed_hashes);
+	} else {
+		Hash(keys, *FlatVector::IncrementalSelectionVector(), keys.size(), hashes);
+	}
 
 	// find out which keys we can match with the current pinned partitions
 	SelectionVector true_sel;
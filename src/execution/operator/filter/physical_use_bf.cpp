@@ -2,38 +2,137 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/optimizer/predicate_transfer/hash_filter/hash_filter_use_kernel.hpp"
 #include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter_use_kernel.hpp"
+#include "duckdb/optimizer/predicate_transfer/range_filter.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_key_hash.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/adaptive_transfer_filter.hpp"
+#include "duckdb/common/chrono.hpp"
 
 namespace duckdb {
-#ifdef UseHashFilter
-PhysicalUseBF::PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<HashFilter>> bf, idx_t estimated_cardinality)
-#else
-PhysicalUseBF::PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<BlockedBloomFilter>> bf, idx_t estimated_cardinality)
-#endif
+PhysicalUseBF::PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<TransferFilter>> bf, idx_t estimated_cardinality)
     : CachingPhysicalOperator(PhysicalOperatorType::USE_BF, std::move(types), estimated_cardinality), bf_to_use(bf) {}
     
+class UseBFState : public CachingOperatorState {
+public:
+	UseBFState(const vector<shared_ptr<TransferFilter>> &filters, const vector<idx_t> &hash_column_keys)
+	    : sel(STANDARD_VECTOR_SIZE), adaptive_filter(filters.size()) {
+		// Bloom filters applied on the same columns share one hash vector
+		for (auto &filter : filters) {
+			idx_t slot = DConstants::INVALID_INDEX;
+			if (filter->GetFilterType() == TransferFilterType::BLOOM_FILTER) {
+				for (idx_t i = 0; i < hash_columns.size(); i++) {
+					if (hash_columns[i] == filter->BoundColsApplied) {
+						slot = i;
+						break;
+					}
+				}
+				if (slot == DConstants::INVALID_INDEX) {
+					slot = hash_columns.size();
+					hash_columns.push_back(filter->BoundColsApplied);
+					hashes.emplace_back(LogicalType::HASH);
+				}
+			}
+			hash_slots.push_back(slot);
+		}
+		hashes_ready.resize(hash_columns.size());
+		for (idx_t i = 0; i < hash_columns.size(); i++) {
+			if (!hash_column_keys.empty() && hash_columns[i] == hash_column_keys) {
+				output_slot = i;
+			}
+		}
+	}
+
+	//! For every filter, the index of its hash vector (INVALID_INDEX for hash filters)
+	vector<idx_t> hash_slots;
+	vector<vector<idx_t>> hash_columns;
+	vector<Vector> hashes;
+	vector<bool> hashes_ready;
+	//! The hash vector that is appended to the output (INVALID_INDEX if none)
+	idx_t output_slot = DConstants::INVALID_INDEX;
+	//! The rows that survived all filters probed so far
+	SelectionVector sel;
+	//! Probe order and disabled filters, adapted to the observed pass rates
+	AdaptiveTransferFilter adaptive_filter;
+};
+
 unique_ptr<OperatorState> PhysicalUseBF::GetOperatorState(ExecutionContext &context) const {
-	return make_uniq<CachingOperatorState>();
+	return make_uniq<UseBFState>(bf_to_use, hash_column_keys);
 }
 
 OperatorResultType PhysicalUseBF::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                   GlobalOperatorState &gstate, OperatorState &state_p) const {
-	auto &state = state_p.Cast<CachingOperatorState>();
+	auto &state = state_p.Cast<UseBFState>();
+	for (auto &bf : bf_to_use) {
+		if (bf->IsReady() && bf->isEmpty()) {
+			// no key can match: no row of the source can reach the join, stop reading it. Rows cached while the
+			// filter was still being built would not pass it either.
+			if (state.cached_chunk) {
+				state.cached_chunk->Reset();
+			}
+			return OperatorResultType::FINISHED;
+		}
+	}
 	idx_t row_num = input.size();
-    idx_t result_count = input.size();
-	SelectionVector sel(STANDARD_VECTOR_SIZE);
-	auto bf = bf_to_use[0];
-#ifdef UseHashFilter
-	HashFilterUseKernel::filter(input.data, bf, sel, result_count, row_num);
-#else
-	BloomFilterUseKernel::filter(input.data, bf, sel, result_count, row_num);
-#endif
+	idx_t result_count = row_num;
+	// all filters are probed on a shrinking selection and the chunk is sliced once at the end
+	const SelectionVector *sel = nullptr;
+	std::fill(state.hashes_ready.begin(), state.hashes_ready.end(), false);
+	auto &adaptive_filter = state.adaptive_filter;
+	for (idx_t p = 0; p < adaptive_filter.permutation.size() && result_count > 0; p++) {
+		auto i = adaptive_filter.permutation[p];
+		if (adaptive_filter.IsDisabled(i)) {
+			continue;
+		}
+		auto &bf = bf_to_use[i];
+		if (!bf->IsReady()) {
+			// pipelined transfer: the filter is still being built, let the rows pass
+			continue;
+		}
+		auto rows_in = result_count;
+		auto start_time = high_resolution_clock::now();
+		if (bf->HasExactKeys()) {
+			// the keys are probed directly, without hashing them
+			bf->ExactKeys().Select(input.data[bf->BoundColsApplied[0]], sel, result_count, state.sel, result_count);
+		} else if (bf->GetFilterType() == TransferFilterType::HASH_FILTER) {
+			HashFilterUseKernel::filter(input.data, bf->Cast<HashFilter>(), sel, result_count, state.sel, result_count);
+		} else if (bf->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+			bf->Cast<RangeFilter>().Select(input.data[bf->BoundColsApplied[0]], sel, result_count, state.sel,
+			                               result_count);
+		} else {
+			auto slot = state.hash_slots[i];
+			auto &hashes = state.hashes[slot];
+			if (!state.hashes_ready[slot]) {
+				// the surviving rows are a subset of the rows hashed here, so later filters can reuse them
+				TransferKeyHash::Hash(input.data, state.hash_columns[slot], sel, result_count, hashes);
+				state.hashes_ready[slot] = true;
+			}
+			BloomFilterUseKernel::filter(FlatVector::GetData<hash_t>(hashes), bf->Cast<BlockedBloomFilter>(), sel,
+			                             result_count, state.sel, result_count);
+		}
+		auto end_time = high_resolution_clock::now();
+		adaptive_filter.Update(i, rows_in, result_count, duration_cast<duration<double>>(end_time - start_time).count());
+		sel = &state.sel;
+	}
+	adaptive_filter.AdaptRuntimeStatistics();
+	auto output_slot = state.output_slot;
+	if (output_slot != DConstants::INVALID_INDEX && !state.hashes_ready[output_slot] && result_count > 0) {
+		// the filter on these columns was disabled (or never reached): hash the surviving rows for the parent
+		TransferKeyHash::Hash(input.data, state.hash_columns[output_slot], sel, result_count,
+		                      state.hashes[output_slot]);
+	}
 	if (result_count == row_num) {
 		// nothing was filtered: skip adding any selection vectors
 		chunk.Reference(input);
+		if (output_slot != DConstants::INVALID_INDEX) {
+			chunk.data.back().Reference(state.hashes[output_slot]);
+		}
 	} else {
-		chunk.Slice(input, sel, result_count);
+		chunk.Slice(input, state.sel, result_count);
+		if (output_slot != DConstants::INVALID_INDEX) {
+			chunk.data.back().Slice(state.hashes[output_slot], state.sel, result_count);
+		}
 	}
 	return OperatorResultType::NEED_MORE_INPUT;
 }
@@ -43,6 +142,20 @@ string PhysicalUseBF::ParamsToString() const {
 	return result;
 }
 
+bool PhysicalUseBF::EmitHashColumn(const vector<idx_t> &key_columns) {
+	if (!hash_column_keys.empty()) {
+		return false;
+	}
+	for (auto &filter : bf_to_use) {
+		if (filter->GetFilterType() == TransferFilterType::BLOOM_FILTER && filter->BoundColsApplied == key_columns) {
+			hash_column_keys = key_columns;
+			types.emplace_back(LogicalType::HASH);
+			return true;
+		}
+	}
+	return false;
+}
+
 void PhysicalUseBF::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
 	op_state.reset();
 
@@ -1,7 +1,10 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/adaptive_transfer_filter.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/filter/physical_use_bf.hpp"
+#include "duckdb/execution/operator/persistent/physical_create_bf.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -14,15 +17,9 @@
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
-
-#ifdef BloomJoin
 #include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter_use_kernel.hpp"
-#endif
 
-#ifdef External
-#include <iostream>
-#endif
+#include <thread>
 
 namespace duckdb {
 
@@ -103,18 +100,34 @@ public:
 		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
 		// for external hash join
 		external = ClientConfig::GetConfig(context).force_external;
-		// Set probe types
-		const auto &payload_types = op.children[0]->types;
+		// Set probe types (the HASH column of the join keys is consumed by the join, so it is never spilled)
+		auto payload_types = op.children[0]->types;
+		if (op.probe_hash_column != DConstants::INVALID_INDEX) {
+			payload_types.erase(payload_types.begin() + op.probe_hash_column);
+		}
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
-#ifdef BloomJoin
+		// for sideways bloom join
+		use_bloom_filter =
+		    ClientConfig::GetConfig(context).predicate_transfer_mode == PredicateTransferMode::BLOOM_JOIN;
 		bloomfilter = op.bloomfilter;
-#endif 
+		if (use_bloom_filter) {
+			bloomfilter->SetFalsePositiveRate(ClientConfig::GetConfig(context).transfer_false_positive_rate);
+			bloomfilter->SetPrefetchDistance(ClientConfig::GetConfig(context).transfer_prefetch_distance);
+			bloomfilter->SetLayout(ClientConfig::GetConfig(context).transfer_bloom_layout);
+			bloomfilter->SetProbeCardinality(op.children[0]->estimated_cardinality);
+		}
+		if (op.bloom_filter_pushed_down) {
+			// the scan must not probe the keys of an earlier execution of this plan until the filter is built again
+			bloomfilter->SetPipelined();
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Whether to build the Bloom filter, decided once the hash table is complete
+	bool BuildBloomFilter() const;
 
 public:
 	ClientContext &context;
@@ -141,10 +154,13 @@ public:
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
 
-#ifdef BloomJoin
+	//! Whether a Bloom filter on the build keys is built and probed (predicate_transfer_mode = bloom_join)
+	bool use_bloom_filter;
+	//! Only set when the filter is actually built, i.e. for in-memory joins
 	shared_ptr<BloomFilterBuilder> builder;
+	//! Whether the builder takes inserts from all finalize tasks at once (predicate_transfer_parallel_bloom_build)
+	bool parallel_bloom_build = false;
 	shared_ptr<BlockedBloomFilter> bloomfilter;
-#endif
 
 	const PhysicalHashJoin &op;
 };
@@ -165,11 +181,23 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.DistinctKeyBuild()) {
+			distinct_keys = make_uniq<GroupedAggregateHashTable>(context, allocator, op.condition_types);
+		}
 	}
 
 public:
 	PartitionedTupleDataAppendState append_state;
 
+	//! The keys this thread inserted so far, while the build drops duplicate keys
+	unique_ptr<GroupedAggregateHashTable> distinct_keys;
+	Vector distinct_addresses {LogicalType::POINTER};
+	SelectionVector distinct_sel {STANDARD_VECTOR_SIZE};
+	//! The rows seen and the rows with a new key while dropping duplicates
+	idx_t distinct_rows_in = 0;
+	idx_t distinct_rows_out = 0;
+
 	ExpressionExecutor join_key_executor;
 	DataChunk join_keys;
 
@@ -245,12 +273,41 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	// the keys were already hashed by the CreateBF below us
+	Vector *build_hashes = nullptr;
+	if (build_hash_column != DConstants::INVALID_INDEX) {
+		build_hashes = &chunk.data[build_hash_column];
+	}
+
+	// only the first row of every key matters to a key-only build: drop the rest before they reach the HT
+	Vector distinct_hashes(LogicalType::HASH);
+	if (lstate.distinct_keys) {
+		auto row_count = lstate.join_keys.size();
+		auto new_count =
+		    lstate.distinct_keys->FindOrCreateGroups(lstate.join_keys, lstate.distinct_addresses, lstate.distinct_sel);
+		lstate.distinct_rows_in += row_count;
+		lstate.distinct_rows_out += new_count;
+		if (new_count < row_count) {
+			lstate.join_keys.Slice(lstate.distinct_sel, new_count);
+			if (build_hashes) {
+				distinct_hashes.Slice(*build_hashes, lstate.distinct_sel, new_count);
+				build_hashes = &distinct_hashes;
+			}
+		}
+		// stop once the keys turn out to be (nearly) unique, or too many to keep a second time
+		if ((lstate.distinct_rows_in >= DISTINCT_BUILD_MIN_ROWS &&
+		     double(lstate.distinct_rows_out) > DISTINCT_BUILD_MAX_PASS_RATE * double(lstate.distinct_rows_in)) ||
+		    lstate.distinct_keys->Count() > DISTINCT_BUILD_MAX_KEYS) {
+			lstate.distinct_keys.reset();
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
 		// there are only keys: place an empty chunk in the payload
-		lstate.payload_chunk.SetCardinality(chunk.size());
-		ht.Build(lstate.append_state, lstate.join_keys, lstate.payload_chunk);
+		lstate.payload_chunk.SetCardinality(lstate.join_keys.size());
+		ht.Build(lstate.append_state, lstate.join_keys, lstate.payload_chunk, build_hashes);
 	} else {
 		// there are payload columns
 		lstate.payload_chunk.Reset();
@@ -258,7 +315,7 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 		for (idx_t i = 0; i < payload_column_idxs.size(); i++) {
 			lstate.payload_chunk.data[i].Reference(chunk.data[payload_column_idxs[i]]);
 		}
-		ht.Build(lstate.append_state, lstate.join_keys, lstate.payload_chunk);
+		ht.Build(lstate.append_state, lstate.join_keys, lstate.payload_chunk, build_hashes);
 	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -281,7 +338,6 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
-#ifdef BloomJoin
 struct SchedulerThread {
 #ifndef DUCKDB_NO_THREADS
 	explicit SchedulerThread(unique_ptr<std::thread> thread_p) : internal_thread(std::move(thread_p)) {
@@ -290,7 +346,6 @@ struct SchedulerThread {
 	unique_ptr<std::thread> internal_thread;
 #endif
 };
-#endif
 
 class HashJoinFinalizeTask : public ExecutorTask {
 public:
@@ -303,30 +358,36 @@ public:
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		ThreadContext tcontext(this->executor.context);
 		tcontext.profiler.StartOperator(&sink.op);
-#ifdef BloomJoin
-		Vector hashes(LogicalType::HASH);
-		auto hash_data = FlatVector::GetData<hash_t>(hashes);
-		TupleDataChunkIterator iterator(sink.hash_table->GetDataCollection(),
-										TupleDataPinProperties::KEEP_EVERYTHING_PINNED,
-										chunk_idx_from, chunk_idx_to, false);
-		const auto row_locations = iterator.GetRowLocations();
-		do {
-			const auto count = iterator.GetCurrentChunkCount();
-			for (idx_t i = 0; i < count; i++) {
-				hash_data[i] = Load<hash_t>(row_locations[i] + sink.hash_table->pointer_offset);
-			}
-			auto &threads = TaskScheduler::GetScheduler(this->executor.context).threads;
-			size_t thread_id = 0;
-			std::thread::id threadId = std::this_thread::get_id();
-			for(size_t i = 0; i < threads.size(); i++) {
-				if (threadId == threads[i]->internal_thread->get_id()) {
-					thread_id = i + 1;
-					break;
+		if (sink.builder) {
+			Vector hashes(LogicalType::HASH);
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			TupleDataChunkIterator iterator(sink.hash_table->GetDataCollection(),
+			                                TupleDataPinProperties::KEEP_EVERYTHING_PINNED,
+			                                chunk_idx_from, chunk_idx_to, false);
+			const auto row_locations = iterator.GetRowLocations();
+			do {
+				const auto count = iterator.GetCurrentChunkCount();
+				for (idx_t i = 0; i < count; i++) {
+					hash_data[i] = Load<hash_t>(row_locations[i] + sink.hash_table->pointer_offset);
 				}
-			}
-			sink.builder->PushNextBatch(thread_id, count, hash_data);
-		} while (iterator.Next());
-#endif
+				auto &threads = TaskScheduler::GetScheduler(this->executor.context).threads;
+				size_t thread_id = 0;
+				std::thread::id threadId = std::this_thread::get_id();
+				for(size_t i = 0; i < threads.size(); i++) {
+					if (threadId == threads[i]->internal_thread->get_id()) {
+						thread_id = i + 1;
+						break;
+					}
+				}
+				if (sink.parallel_bloom_build) {
+					sink.builder->PushNextBatch(thread_id, count, hash_data);
+				} else {
+					// the single-threaded builder takes the chunks of the parallel finalize tasks one at a time
+					lock_guard<mutex> guard(sink.lock);
+					sink.builder->PushNextBatch(thread_id, count, hash_data);
+				}
+			} while (iterator.Next());
+		}
 		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
 		tcontext.profiler.EndOperator(nullptr);
 		this->executor.Flush(tcontext);
@@ -362,10 +423,10 @@ public:
 			// Single-threaded finalize
 			finalize_tasks.push_back(
 			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0, chunk_count, false));
-#ifdef BloomJoin
-			sink.builder = make_shared<BloomFilterBuilder_SingleThreaded>();
-			sink.builder->Begin(1, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), ht.GetDataCollection().Count(), 0, sink.bloomfilter.get());
-#endif
+			if (sink.BuildBloomFilter()) {
+				sink.builder = make_shared<BloomFilterBuilder_SingleThreaded>();
+				sink.builder->Begin(1, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), ht.GetDataCollection().Count(), 0, sink.bloomfilter.get());
+			}
 		} else {
 			// Parallel finalize
 			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
@@ -381,10 +442,17 @@ public:
 					break;
 				}
 			}
-#ifdef BloomJoin
-			sink.builder = make_shared<BloomFilterBuilder_Parallel>();
-			sink.builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), ht.GetDataCollection().Count(), 0, sink.bloomfilter.get());
-#endif
+			if (sink.BuildBloomFilter()) {
+				// the partition-locked parallel insert is opt-in
+				sink.parallel_bloom_build = ClientConfig::GetConfig(context).transfer_parallel_bloom_build;
+				if (sink.parallel_bloom_build) {
+					sink.builder = make_shared<BloomFilterBuilder_Parallel>();
+					sink.builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), ht.GetDataCollection().Count(), 0, sink.bloomfilter.get());
+				} else {
+					sink.builder = make_shared<BloomFilterBuilder_SingleThreaded>();
+					sink.builder->Begin(1, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), ht.GetDataCollection().Count(), 0, sink.bloomfilter.get());
+				}
+			}
 		}
 		SetTasks(std::move(finalize_tasks));
 	}
@@ -392,6 +460,11 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.builder) {
+			// the probe side scan starts probing the filter
+			sink.bloomfilter->ResetProbeStats();
+			sink.bloomfilter->Publish();
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -407,6 +480,30 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+bool HashJoinGlobalSinkState::BuildBloomFilter() const {
+	if (!use_bloom_filter || external) {
+		return false;
+	}
+	switch (ClientConfig::GetConfig(context).bloom_join_filter_mode) {
+	case BloomJoinFilterMode::ALWAYS:
+		return true;
+	case BloomJoinFilterMode::NEVER:
+		return false;
+	default:
+		break;
+	}
+	if (op.bloom_filter_pushed_down) {
+		// the probe side scan drops the rows that miss, which then are neither produced nor probed through the joins
+		// in between: that pays off whatever the size of this hash table
+		return true;
+	}
+	// a hash table that stays in the last level cache is probed about as fast as the filter, which then only saves
+	// the key comparisons of the few rows that hit a chain; an unknown cache size keeps the filter
+	auto cache_size = arrow::internal::CpuInfo::GetInstance()->CacheSize(arrow::internal::CpuInfo::CacheLevel::L3);
+	auto ht_size = hash_table->SizeInBytes() + JoinHashTable::PointerTableSize(hash_table->Count());
+	return cache_size <= 0 || ht_size > idx_t(cache_size);
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -514,9 +611,6 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 
 	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
 	if (sink.external) {
-#ifdef External
-		std::cout << "External Hash Join" << std::endl;
-#endif
 		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
 		// External Hash Join
 		sink.perfect_join_executor.reset();
@@ -571,15 +665,22 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 //===--------------------------------------------------------------------===//
 class HashJoinOperatorState : public CachingOperatorState {
 public:
-	explicit HashJoinOperatorState(ClientContext &context) : probe_executor(context), initialized(false) {
+	explicit HashJoinOperatorState(ClientContext &context)
+	    : probe_hashes(LogicalType::HASH), probe_executor(context), bloom_filter_stats(1), initialized(false) {
 	}
 
 	DataChunk join_keys;
 	TupleDataChunkState join_key_state;
+	//! The probe input without the HASH column appended by a UseBF (only used if there is one)
+	DataChunk probe_input;
+	//! The hashes of the join keys of the chunk currently being probed
+	Vector probe_hashes;
 
 	ExpressionExecutor probe_executor;
 	unique_ptr<JoinHashTable::ScanStructure> scan_structure;
 	unique_ptr<OperatorState> perfect_hash_join_state;
+	//! Pass rate of the Bloom filter probed by this thread, which switches it off once it hardly removes any row
+	AdaptiveTransferFilter bloom_filter_stats;
 
 	bool initialized;
 	JoinHashTable::ProbeSpillLocalAppendState spill_state;
@@ -605,6 +706,11 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 		}
 		TupleDataCollection::InitializeChunkState(state->join_key_state, condition_types);
 	}
+	if (probe_hash_column != DConstants::INVALID_INDEX) {
+		auto probe_input_types = children[0]->types;
+		probe_input_types.erase(probe_input_types.begin() + probe_hash_column);
+		state->probe_input.InitializeEmpty(probe_input_types);
+	}
 	if (sink.external) {
 		state->spill_chunk.Initialize(allocator, sink.probe_types);
 		sink.InitializeProbeSpill();
@@ -613,13 +719,25 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 	return std::move(state);
 }
 
-OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input_p, DataChunk &chunk,
                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = state_p.Cast<HashJoinOperatorState>();
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
 	D_ASSERT(sink.finalized);
 	D_ASSERT(!sink.scanned_data);
 
+	// split off the hashes of the join keys computed by the UseBF below us; while a scan structure is pending the
+	// (possibly sliced) view of the previous call is kept
+	const bool has_probe_hashes = probe_hash_column != DConstants::INVALID_INDEX;
+	auto &input = has_probe_hashes ? state.probe_input : input_p;
+	if (has_probe_hashes && !state.scan_structure) {
+		state.probe_input.SetCardinality(input_p);
+		for (idx_t i = 0; i < state.probe_input.ColumnCount(); i++) {
+			state.probe_input.data[i].Reference(input_p.data[i]);
+		}
+		state.probe_hashes.Reference(input_p.data[probe_hash_column]);
+	}
+
 	// some initialization for external hash join
 	if (sink.external && !state.initialized) {
 		if (!sink.probe_spill) {
@@ -658,29 +776,41 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
 
-#ifdef BloomJoin
-	Vector hashes(LogicalType::HASH);
-	VectorOperations::Hash(state.join_keys.data[0], hashes, state.join_keys.size());
-	for (idx_t i = 1; i < sink.hash_table->equality_types.size(); i++) {
-		VectorOperations::CombineHash(hashes, state.join_keys.data[i], state.join_keys.size());
-	}
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-        hashes.Flatten(state.join_keys.size());
-    }
-	idx_t result_count = 0;
-	idx_t row_num = input.size();
-	SelectionVector sel(STANDARD_VECTOR_SIZE);
-	bloomfilter->Find(arrow::internal::CpuInfo::AVX2, row_num, (hash_t*)hashes.GetData(), sel, result_count, false);
-	input.Slice(sel, result_count);
-	state.join_keys.Slice(sel, result_count);
-#endif
+	// the filter may only drop the probe rows without a match, a scan below us already dropped them
+	const bool probe_bloom_filter = sink.builder && !bloom_filter_pushed_down && EmptyResultIfRHSIsEmpty() &&
+	                                !state.bloom_filter_stats.IsDisabled(0);
+	if (probe_bloom_filter) {
+		// the hashes probed in the Bloom filter are the ones the hash table is probed with
+		if (!has_probe_hashes) {
+			Vector hashes(LogicalType::HASH);
+			VectorOperations::Hash(state.join_keys.data[0], hashes, state.join_keys.size());
+			for (idx_t i = 1; i < sink.hash_table->equality_types.size(); i++) {
+				VectorOperations::CombineHash(hashes, state.join_keys.data[i], state.join_keys.size());
+			}
+			state.probe_hashes.Reference(hashes);
+		}
+		state.probe_hashes.Flatten(state.join_keys.size());
+		idx_t result_count = 0;
+		idx_t row_num = input.size();
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		bloomfilter->Find(arrow::internal::CpuInfo::AVX2, row_num, FlatVector::GetData<hash_t>(state.probe_hashes), sel,
+		                  result_count, false);
+		// a filter that keeps nearly every probe row only adds its probe to the hash table lookup
+		state.bloom_filter_stats.Update(0, row_num, result_count, 0);
+		state.bloom_filter_stats.AdaptRuntimeStatistics();
+		input.Slice(sel, result_count);
+		state.join_keys.Slice(sel, result_count);
+		state.probe_hashes.Slice(sel, result_count);
+	}
+	auto precomputed_hashes = has_probe_hashes || probe_bloom_filter ? &state.probe_hashes : nullptr;
 
 	// perform the actual probe
 	if (sink.external) {
-		state.scan_structure = sink.hash_table->ProbeAndSpill(state.join_keys, state.join_key_state, input,
-		                                                      *sink.probe_spill, state.spill_state, state.spill_chunk);
+		state.scan_structure =
+		    sink.hash_table->ProbeAndSpill(state.join_keys, state.join_key_state, input, *sink.probe_spill,
+		                                   state.spill_state, state.spill_chunk, precomputed_hashes);
 	} else {
-		state.scan_structure = sink.hash_table->Probe(state.join_keys, state.join_key_state);
+		state.scan_structure = sink.hash_table->Probe(state.join_keys, state.join_key_state, precomputed_hashes);
 	}
 	state.scan_structure->Next(state.join_keys, input, chunk);
 	return OperatorResultType::HAVE_MORE_OUTPUT;
@@ -1137,4 +1267,52 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 	return progress * 100.0;
 }
 
+bool PhysicalHashJoin::DistinctKeyBuild() const {
+	// the correlated MARK join counts the rows of every key
+	return (join_type == JoinType::SEMI || join_type == JoinType::ANTI || join_type == JoinType::MARK) &&
+	       delim_types.empty() && payload_types.empty();
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+bool PhysicalHashJoin::GetEqualityKeyColumns(vector<idx_t> &build_columns, vector<idx_t> &probe_columns) const {
+	// the hash table only hashes the leading equality conditions
+	for (auto &condition : conditions) {
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL &&
+		    condition.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			break;
+		}
+		if (condition.left->type != ExpressionType::BOUND_REF || condition.right->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		probe_columns.push_back(condition.left->Cast<BoundReferenceExpression>().index);
+		build_columns.push_back(condition.right->Cast<BoundReferenceExpression>().index);
+	}
+	return !build_columns.empty();
+}
+
+void PhysicalHashJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	PhysicalJoin::BuildPipelines(current, meta_pipeline);
+
+	// CreateBF and UseBF hash the same columns with the same hash function: let them hand their hashes to us
+	vector<idx_t> build_columns;
+	vector<idx_t> probe_columns;
+	if (!GetEqualityKeyColumns(build_columns, probe_columns)) {
+		return;
+	}
+	if (build_hash_column == DConstants::INVALID_INDEX && children[1]->type == PhysicalOperatorType::CREATE_BF) {
+		auto &create_bf = children[1]->Cast<PhysicalCreateBF>();
+		if (create_bf.EmitHashColumn(build_columns)) {
+			build_hash_column = create_bf.types.size() - 1;
+		}
+	}
+	if (probe_hash_column == DConstants::INVALID_INDEX && children[0]->type == PhysicalOperatorType::USE_BF) {
+		auto &use_bf = children[0]->Cast<PhysicalUseBF>();
+		if (use_bf.EmitHashColumn(probe_columns)) {
+			probe_hash_column = use_bf.types.size() - 1;
+		}
+	}
+}
+
 } // namespace duckdb
@@ -8,37 +8,181 @@
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/optimizer/predicate_transfer/range_filter.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_key_hash.hpp"
 
 #include <sys/types.h>
 #include <thread>
 
 namespace duckdb {
-#ifdef UseHashFilter
-PhysicalCreateBF::PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<HashFilter>> bf, idx_t estimated_cardinality)
-#else
-PhysicalCreateBF::PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<BlockedBloomFilter>> bf, idx_t estimated_cardinality)
-#endif
+PhysicalCreateBF::PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<TransferFilter>> bf, idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::CREATE_BF, std::move(types), estimated_cardinality), bf_to_create(bf) {
 		count_for_debug = make_shared<idx_t>(0);
 	}
 
+//===--------------------------------------------------------------------===//
+// Key summaries
+//===--------------------------------------------------------------------===//
+/* Key types whose min/max is tracked for zonemap pruning on the probe side */
+static bool TracksKeyRange(const LogicalType &type) {
+	if (BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* One (empty) min/max statistics per single-column filter on a numeric key, nullptr for the other filters */
+static vector<unique_ptr<BaseStatistics>> InitializeKeyStats(const PhysicalCreateBF &op) {
+	vector<unique_ptr<BaseStatistics>> key_stats;
+	for (auto &filter : op.bf_to_create) {
+		if (filter->BoundColsBuilt.size() == 1 && TracksKeyRange(op.types[filter->BoundColsBuilt[0]])) {
+			key_stats.emplace_back(BaseStatistics::CreateEmpty(op.types[filter->BoundColsBuilt[0]]).ToUnique());
+		} else {
+			key_stats.emplace_back(nullptr);
+		}
+	}
+	return key_stats;
+}
+
+template <class T>
+static void TemplatedUpdateKeyRange(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			NumericStats::Update<T>(stats, data[idx]);
+		}
+	}
+}
+
+static void UpdateKeyRange(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::UINT8:
+		TemplatedUpdateKeyRange<uint8_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateKeyRange<uint16_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateKeyRange<uint32_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateKeyRange<uint64_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateKeyRange<uhugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT8:
+		TemplatedUpdateKeyRange<int8_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateKeyRange<int16_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateKeyRange<int32_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateKeyRange<int64_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateKeyRange<hugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedUpdateKeyRange<float>(stats, keys, count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedUpdateKeyRange<double>(stats, keys, count);
+		break;
+	default:
+		throw InternalException("Unsupported key type for the CreateBF key range");
+	}
+}
+
+static void UpdateKeyRanges(const PhysicalCreateBF &op, vector<unique_ptr<BaseStatistics>> &key_stats,
+                            DataChunk &chunk) {
+	for (idx_t i = 0; i < key_stats.size(); i++) {
+		if (key_stats[i]) {
+			UpdateKeyRange(*key_stats[i], chunk.data[op.bf_to_create[i]->BoundColsBuilt[0]], chunk.size());
+		}
+	}
+}
+
+/* One HyperLogLog per Bloom or hash filter, nullptr for range filters. It sizes the Bloom filters and decides
+ * whether an exact key set can replace a filter */
+static vector<unique_ptr<DistinctStatistics>> InitializeKeyDistinct(const PhysicalCreateBF &op) {
+	vector<unique_ptr<DistinctStatistics>> key_distinct;
+	for (auto &filter : op.bf_to_create) {
+		if (filter->GetFilterType() != TransferFilterType::RANGE_FILTER) {
+			key_distinct.emplace_back(make_uniq<DistinctStatistics>());
+		} else {
+			key_distinct.emplace_back(nullptr);
+		}
+	}
+	return key_distinct;
+}
+
+static void UpdateKeyDistinct(DistinctStatistics &distinct, const vector<idx_t> &cols, DataChunk &chunk,
+                              Vector &hashes) {
+	if (cols.size() == 1 && DistinctStatistics::TypeIsSupported(chunk.data[cols[0]].GetType())) {
+		distinct.Update(chunk.data[cols[0]], chunk.size());
+		return;
+	}
+	// composite keys are counted through their combined hash
+	TransferKeyHash::Hash(chunk.data, cols, nullptr, chunk.size(), hashes);
+	distinct.Update(hashes, chunk.size());
+}
+
+/* Remember the distinct keys of every single-column filter, the build side must be small */
+static void CollectKeyLists(const vector<shared_ptr<TransferFilter>> &filters, vector<value_set_t> &key_sets,
+                            DataChunk &chunk) {
+	for (idx_t i = 0; i < filters.size(); i++) {
+		if (filters[i]->BoundColsBuilt.size() != 1 || filters[i]->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+			continue;
+		}
+		auto &keys = chunk.data[filters[i]->BoundColsBuilt[0]];
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			auto key = keys.GetValue(row);
+			if (!key.IsNull()) {
+				key_sets[i].insert(std::move(key));
+			}
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
 class CreateBFGlobalSinkState : public GlobalSinkState {
 public:
 	CreateBFGlobalSinkState(ClientContext &context, const PhysicalCreateBF &op)
-		: op(op), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
-		  partition_start(0), partition_end(0), max_partition_count(0),
-		  max_partition_size(0) {
-#ifdef External
-			TupleDataLayout layout;
-			layout.Initialize(op.types, false);
-			total_data = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(context), layout);
-#else
-			total_data = make_uniq<ColumnDataCollection>(context, op.types);
-#endif
+		: op(op), use_external(ClientConfig::GetConfig(context).transfer_external),
+		  temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), external(false),
+		  key_stats(InitializeKeyStats(op)), key_distinct(InitializeKeyDistinct(op)) {
+			if (!use_external) {
+				total_data = make_uniq<ColumnDataCollection>(context, op.types);
+			}
 		}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -46,72 +190,88 @@ public:
 	mutex glock;
 	const PhysicalCreateBF &op;
 
-	
-#ifdef UseHashFilter
-	vector<shared_ptr<HashFilterBuilder>> builders;
-#else
-	vector<shared_ptr<BloomFilterBuilder>> builders;
-#endif
+	//! Whether the build side is collected in spillable partitions (predicate_transfer_external)
+	bool use_external;
 
-#ifdef External
-	vector<unique_ptr<TupleDataCollection>> local_data_collections;
-	unique_ptr<TupleDataCollection> total_data;
-#else
+	vector<shared_ptr<BloomFilterBuilder>> builders;
+	//! Whether the Bloom filter builders take inserts from all threads at once (predicate_transfer_parallel_bloom_build),
+	//! otherwise the finalize tasks insert one chunk at a time under bloom_insert_lock
+	bool parallel_bloom_build = false;
+	mutex bloom_insert_lock;
+	vector<shared_ptr<HashFilterBuilder>> hash_builders;
+	//! The filters replaced by an exact key set
+	vector<shared_ptr<TransferFilter>> exact_filters;
+
+	//! In-memory collection, used when use_external is false
 	vector<unique_ptr<ColumnDataCollection>> local_data_collections;
 	unique_ptr<ColumnDataCollection> total_data;
-#endif
+
+	//! Spillable partitions of all threads, used when use_external is true. They are never combined: the filters
+	//! are built, and the source scans, partition by partition in parallel
+	vector<unique_ptr<TupleDataCollection>> local_tuple_collections;
+
 	unique_ptr<TemporaryMemoryState> temporary_memory_state;
 
+	//! Whether the partitions exceed the memory reservation, i.e. are (partly) spilled to disk
 	bool external;
-	idx_t max_partition_size;
-	idx_t max_partition_count;
 
-	idx_t partition_start;
-	idx_t partition_end;
+	//! Min/max of the build keys per filter (nullptr if the filter has no key range)
+	vector<unique_ptr<BaseStatistics>> key_stats;
+	//! Distinct build keys per Bloom or hash filter (nullptr for range filters)
+	vector<unique_ptr<DistinctStatistics>> key_distinct;
 };
 
 class CreateBFLocalSinkState : public LocalSinkState {
 public:
 	CreateBFLocalSinkState(ClientContext &context, const PhysicalCreateBF &op) 
-		: client_context(context) {
-#ifdef External
-		TupleDataLayout layout;
-		layout.Initialize(op.types, false);
-		auto local_data_partition = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(context), layout);
-		local_data.emplace_back(std::move(local_data_partition));
-		local_partition_id = 0;
-		temporary_memory_state = TemporaryMemoryManager::Get(context).Register(context);
-#else
-		local_data = make_uniq<ColumnDataCollection>(context, op.types);
-#endif
+		: client_context(context), local_partition_id(0), key_stats(InitializeKeyStats(op)),
+		  key_distinct(InitializeKeyDistinct(op)), key_hashes(LogicalType::HASH) {
+		if (ClientConfig::GetConfig(context).transfer_external) {
+			TupleDataLayout layout;
+			layout.Initialize(op.types, false);
+			auto local_data_partition = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(context), layout);
+			local_tuple_data.emplace_back(std::move(local_data_partition));
+			temporary_memory_state = TemporaryMemoryManager::Get(context).Register(context);
+		} else {
+			local_data = make_uniq<ColumnDataCollection>(context, op.types);
+		}
 	}
 
 	ClientContext &client_context;
 
-#ifdef External
-	vector<unique_ptr<TupleDataCollection>> local_data;
+	unique_ptr<ColumnDataCollection> local_data;
+
+	vector<unique_ptr<TupleDataCollection>> local_tuple_data;
 	idx_t local_partition_id;
 	unique_ptr<TemporaryMemoryState> temporary_memory_state;
-#else
-	unique_ptr<ColumnDataCollection> local_data;
-#endif
+
+	vector<unique_ptr<BaseStatistics>> key_stats;
+	vector<unique_ptr<DistinctStatistics>> key_distinct;
+	//! Scratch space for the hashes of composite keys counted by key_distinct
+	Vector key_hashes;
 };
 
 SinkResultType PhysicalCreateBF::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &state = input.local_state.Cast<CreateBFLocalSinkState>();
-#ifdef External
-	if (state.local_data[state.local_partition_id]->SizeInBytes() + 8 * chunk.size() * chunk.ColumnCount() > state.temporary_memory_state->GetReservation()) {
-		TupleDataLayout layout;
-		layout.Initialize(this->types, false);
-		auto local_data_partition = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(state.client_context), layout);
-		state.local_data.emplace_back(std::move(local_data_partition));
-		state.local_data[++state.local_partition_id]->Append(chunk);
-	} else {
-		state.local_data[state.local_partition_id]->Append(chunk);
+	UpdateKeyRanges(*this, state.key_stats, chunk);
+	for (idx_t i = 0; i < state.key_distinct.size(); i++) {
+		if (state.key_distinct[i]) {
+			UpdateKeyDistinct(*state.key_distinct[i], bf_to_create[i]->BoundColsBuilt, chunk, state.key_hashes);
+		}
+	}
+	if (!state.local_data) {
+		if (state.local_tuple_data[state.local_partition_id]->SizeInBytes() + 8 * chunk.size() * chunk.ColumnCount() > state.temporary_memory_state->GetReservation()) {
+			TupleDataLayout layout;
+			layout.Initialize(this->types, false);
+			auto local_data_partition = make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(state.client_context), layout);
+			state.local_tuple_data.emplace_back(std::move(local_data_partition));
+			state.local_tuple_data[++state.local_partition_id]->Append(chunk);
+		} else {
+			state.local_tuple_data[state.local_partition_id]->Append(chunk);
+		}
+		return SinkResultType::NEED_MORE_INPUT;
 	}
-#else
 	state.local_data->Append(chunk);
-#endif
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -119,12 +279,23 @@ SinkCombineResultType PhysicalCreateBF::Combine(ExecutionContext &context,
                                          		OperatorSinkCombineInput &input) const {
 	auto &gstate = input.global_state.Cast<CreateBFGlobalSinkState>();
 	auto &state = input.local_state.Cast<CreateBFLocalSinkState>();
-#ifdef External
-	gstate.local_data_collections = std::move(state.local_data);
-#else
 	lock_guard<mutex> lock(gstate.glock);
-	gstate.local_data_collections.emplace_back(std::move(state.local_data));
-#endif
+	for (idx_t i = 0; i < state.key_stats.size(); i++) {
+		if (state.key_stats[i]) {
+			gstate.key_stats[i]->Merge(*state.key_stats[i]);
+		}
+		if (state.key_distinct[i]) {
+			gstate.key_distinct[i]->Merge(*state.key_distinct[i]);
+		}
+	}
+	if (gstate.use_external) {
+		for (auto &partition : state.local_tuple_data) {
+			gstate.local_tuple_collections.emplace_back(std::move(partition));
+		}
+		state.local_tuple_data.clear();
+	} else {
+		gstate.local_data_collections.emplace_back(std::move(state.local_data));
+	}
 	return SinkCombineResultType::FINISHED;
 }
 
@@ -140,114 +311,142 @@ struct SchedulerThread {
 #endif
 };
 
+/* The per-thread slot of the parallel filter builders used by the calling thread */
+static size_t GetBuilderThreadId(ClientContext &context) {
+	auto &threads = TaskScheduler::GetScheduler(context).threads;
+	std::thread::id thread_id = std::this_thread::get_id();
+	for (size_t i = 0; i < threads.size(); i++) {
+		if (thread_id == threads[i]->internal_thread->get_id()) {
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+/* Per-thread scratch space to feed chunks to the filter builders. The key columns of the builders are looked up and
+ * the hash vectors allocated once, not for every chunk and builder; Bloom filters on the same key columns share one
+ * hash vector */
+class CreateBFBuildScratch {
+public:
+	CreateBFBuildScratch(const vector<LogicalType> &types, const vector<shared_ptr<BloomFilterBuilder>> &builders,
+	                     const vector<shared_ptr<HashFilterBuilder>> &hash_builders) {
+		for (auto &builder : builders) {
+			auto &cols = builder->BuiltCols();
+			idx_t slot = DConstants::INVALID_INDEX;
+			for (idx_t i = 0; i < hash_columns.size(); i++) {
+				if (hash_columns[i] == cols) {
+					slot = i;
+					break;
+				}
+			}
+			if (slot == DConstants::INVALID_INDEX) {
+				slot = hash_columns.size();
+				hash_columns.push_back(cols);
+				hashes.emplace_back(LogicalType::HASH);
+			}
+			hash_slots.push_back(slot);
+		}
+		for (auto &builder : hash_builders) {
+			auto &cols = builder->BuiltCols();
+			vector<LogicalType> key_types;
+			for (auto col : cols) {
+				key_types.push_back(types[col]);
+			}
+			hash_filter_columns.push_back(cols);
+			hash_filter_inputs.emplace_back(make_uniq<DataChunk>());
+			hash_filter_inputs.back()->InitializeEmpty(key_types);
+		}
+	}
+
+	//! For every Bloom filter builder, the index of its hash vector
+	vector<idx_t> hash_slots;
+	vector<vector<idx_t>> hash_columns;
+	vector<Vector> hashes;
+	//! For every hash filter builder, its key columns and the chunk referencing them
+	vector<vector<idx_t>> hash_filter_columns;
+	vector<unique_ptr<DataChunk>> hash_filter_inputs;
+};
+
+/* Hash the key columns of one chunk and insert them into the Bloom filters. The hashes of the builder at
+ * `output_builder` are computed into `output` instead, for the parent to reuse. Single-threaded builders fed by
+ * several threads insert under `insert_lock` */
+static void PushChunkToBloomBuilders(const vector<shared_ptr<BloomFilterBuilder>> &builders,
+                                     CreateBFBuildScratch &scratch, size_t thread_id, DataChunk &chunk,
+                                     idx_t output_builder = DConstants::INVALID_INDEX, Vector *output = nullptr,
+                                     mutex *insert_lock = nullptr) {
+	idx_t output_slot = DConstants::INVALID_INDEX;
+	if (output_builder != DConstants::INVALID_INDEX) {
+		output_slot = scratch.hash_slots[output_builder];
+		TransferKeyHash::Hash(chunk.data, scratch.hash_columns[output_slot], nullptr, chunk.size(), *output);
+	}
+	for (idx_t slot = 0; slot < scratch.hashes.size(); slot++) {
+		if (slot != output_slot) {
+			TransferKeyHash::Hash(chunk.data, scratch.hash_columns[slot], nullptr, chunk.size(), scratch.hashes[slot]);
+		}
+	}
+	unique_lock<mutex> guard;
+	if (insert_lock) {
+		guard = unique_lock<mutex>(*insert_lock);
+	}
+	for (idx_t i = 0; i < builders.size(); i++) {
+		auto slot = scratch.hash_slots[i];
+		auto &hashes = slot == output_slot ? *output : scratch.hashes[slot];
+		builders[i]->PushNextBatch(thread_id, chunk.size(), FlatVector::GetData<hash_t>(hashes));
+	}
+}
+
+/* Feed one chunk of the build side to every filter builder */
+static void PushChunkToBuilders(CreateBFGlobalSinkState &sink, CreateBFBuildScratch &scratch, size_t thread_id,
+                                DataChunk &chunk) {
+	PushChunkToBloomBuilders(sink.builders, scratch, thread_id, chunk, DConstants::INVALID_INDEX, nullptr,
+	                         sink.parallel_bloom_build ? nullptr : &sink.bloom_insert_lock);
+	for (idx_t i = 0; i < sink.hash_builders.size(); i++) {
+		auto &cols = scratch.hash_filter_columns[i];
+		auto &input = *scratch.hash_filter_inputs[i];
+		for (idx_t c = 0; c < cols.size(); c++) {
+			input.data[c].Reference(chunk.data[cols[c]]);
+		}
+		input.SetCardinality(chunk.size());
+		sink.hash_builders[i]->PushNextBatch(thread_id, chunk.size(), input);
+	}
+	for (auto &filter : sink.exact_filters) {
+		filter->ExactKeys().Insert(chunk.data[filter->BoundColsBuilt[0]], chunk.size());
+	}
+}
+
 class CreateBFFinalizeTask : public ExecutorTask {
 public:
 	CreateBFFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, CreateBFGlobalSinkState &sink_p,
 	                     idx_t chunk_idx_from_p, idx_t chunk_idx_to_p, size_t num_threads)
 	    : ExecutorTask(context), event(std::move(event_p)), sink(sink_p), chunk_idx_from(chunk_idx_from_p),
-	      chunk_idx_to(chunk_idx_to_p), threads(TaskScheduler::GetScheduler(context).threads) {
+	      chunk_idx_to(chunk_idx_to_p) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		ThreadContext tcontext(this->executor.context);
 		tcontext.profiler.StartOperator(&sink.op);
-#ifdef External
-		if (sink.external) {
-			for(int i = 0; i < sink.local_data_collections.size(); i++) {
+		auto thread_id = GetBuilderThreadId(this->executor.context);
+		CreateBFBuildScratch scratch(sink.op.types, sink.builders, sink.hash_builders);
+		if (sink.use_external) {
+			// the range is one of partitions: each is read back (from disk, if spilled) one chunk at a time
+			for (idx_t i = chunk_idx_from; i < chunk_idx_to; i++) {
+				auto &partition = *sink.local_tuple_collections[i];
 				DataChunk chunk;
-				sink.local_data_collections[i]->InitializeChunk(chunk);
+				partition.InitializeChunk(chunk);
 				TupleDataScanState state;
-				sink.local_data_collections[i]->InitializeScan(state);
-				while (true) {
-					sink.local_data_collections[i]->Scan(state, chunk);
-					if (chunk.size() == 0) {
-						break;
-					}
-					for(auto &builder : sink.builders) {
-						auto cols = builder->BuiltCols();
-						Vector hashes(LogicalType::HASH);
-						VectorOperations::Hash(chunk.data[cols[0]], hashes, chunk.size());
-						for(int i = 1; i < cols.size(); i++) {
-							VectorOperations::CombineHash(hashes, chunk.data[cols[i]], chunk.size());
-						}
-						if(hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-							hashes.Flatten(chunk.size());
-						}
-						builder->PushNextBatch(0, chunk.size(), (hash_t*)hashes.GetData());
-					}
+				partition.InitializeScan(state);
+				while (partition.Scan(state, chunk)) {
+					PushChunkToBuilders(sink, scratch, thread_id, chunk);
 				}
 			}
 		} else {
-			DataChunk chunk;
-			TupleDataScanState state;
-			sink.total_data->InitializeChunk(chunk);
-			sink.total_data->InitializeScan(state);
-			while (true) {
-				sink.total_data->Scan(state, chunk);
-				if (chunk.size() == 0) {
-					break;
-				}
-				for(auto &builder : sink.builders) {
-					auto cols = builder->BuiltCols();
-					Vector hashes(LogicalType::HASH);
-					VectorOperations::Hash(chunk.data[cols[0]], hashes, chunk.size());
-					for(int i = 1; i < cols.size(); i++) {
-						VectorOperations::CombineHash(hashes, chunk.data[cols[i]], chunk.size());
-					}
-					if(hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-						hashes.Flatten(chunk.size());
-					}
-					builder->PushNextBatch(0, chunk.size(), (hash_t*)hashes.GetData());
-				}
-			}
-		}
-#else
-		size_t thread_id = 0;
-		std::thread::id threadId = std::this_thread::get_id();
-		for(size_t i = 0; i < threads.size(); i++) {
-			if (threadId == threads[i]->internal_thread->get_id()) {
-				thread_id = i + 1;
-				break;
-			}
-		}
-		for (idx_t i = chunk_idx_from; i < chunk_idx_to; i++) {
-			DataChunk chunk;
-			sink.total_data->InitializeScanChunk(chunk);
-			sink.total_data->FetchChunk(i, chunk);
-			for(auto &builder : sink.builders) {
-				auto cols = builder->BuiltCols();
-#ifdef UseHashFilter
-				DataChunk input;
-				input.SetCardinality(chunk.size());
-				for(int i = 0; i < cols.size(); i++) {
-					Vector v = chunk.data[cols[i]];
-					input.data.emplace_back(v);
-				}
-				builder->PushNextBatch(thread_id, chunk.size(), input);
-#else
-				Vector hashes(LogicalType::HASH);
-				VectorOperations::Hash(chunk.data[cols[0]], hashes, chunk.size());
-				for(int i = 1; i < cols.size(); i++) {
-					VectorOperations::CombineHash(hashes, chunk.data[cols[i]], chunk.size());
-				}
-				if(hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-					hashes.Flatten(chunk.size());
-				}
-				builder->PushNextBatch(thread_id, chunk.size(), (hash_t*)hashes.GetData());
-#endif
-			}
-		}
-#ifdef UseHashFilter
-		for (auto &builder : sink.builders) {
-			builder->build_target_->hash_table->Unpartition();
-			builder->build_target_->hash_table->InitializePointerTable();
-			const auto chunk_count = builder->build_target_->hash_table->GetDataCollection().ChunkCount();
-			if(chunk_count > 0) {
-				builder->build_target_->hash_table->Finalize(0, chunk_count, false);
+			for (idx_t i = chunk_idx_from; i < chunk_idx_to; i++) {
+				DataChunk chunk;
+				sink.total_data->InitializeScanChunk(chunk);
+				sink.total_data->FetchChunk(i, chunk);
+				PushChunkToBuilders(sink, scratch, thread_id, chunk);
 			}
 		}
-#endif
-#endif
 		event->FinishTask();
 		tcontext.profiler.EndOperator(nullptr);
 		this->executor.Flush(tcontext);
@@ -259,7 +458,6 @@ private:
 	CreateBFGlobalSinkState &sink;
 	idx_t chunk_idx_from;
 	idx_t chunk_idx_to;
-	vector<duckdb::unique_ptr<duckdb::SchedulerThread>> &threads;
 };
 
 class CreateBFFinalizeEvent : public BasePipelineEvent {
@@ -275,10 +473,20 @@ public:
 		auto &context = pipeline->GetClientContext();
 
 		vector<shared_ptr<Task>> finalize_tasks;
-		auto &buffer = sink.total_data;
-		const auto chunk_count = buffer->ChunkCount();
+		// spillable partitions are distributed over the tasks as a whole, in-memory data by chunks
+		idx_t chunk_count = 0;
+		idx_t row_count = 0;
+		if (sink.use_external) {
+			chunk_count = sink.local_tuple_collections.size();
+			for (auto &partition : sink.local_tuple_collections) {
+				row_count += partition->Count();
+			}
+		} else {
+			chunk_count = sink.total_data->ChunkCount();
+			row_count = sink.total_data->Count();
+		}
 		const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
-		if (num_threads == 1 || (buffer->Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
+		if (num_threads == 1 || (row_count < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
 			// Single-threaded finalize
 			finalize_tasks.push_back(make_uniq<CreateBFFinalizeTask>(shared_from_this(), context, sink, 0, chunk_count, 1));
 		} else {
@@ -300,8 +508,24 @@ public:
 		SetTasks(std::move(finalize_tasks));
 	}
 
-	// void FinishEvent() override {
-	// }
+	void FinishEvent() override {
+		// hash filters are probed through the pointer table, which can only be built once all rows are in
+		for (auto &builder : sink.hash_builders) {
+			builder->build_target_->hash_table->Unpartition();
+			builder->build_target_->hash_table->InitializePointerTable();
+			const auto chunk_count = builder->build_target_->hash_table->GetDataCollection().ChunkCount();
+			if(chunk_count > 0) {
+				builder->build_target_->hash_table->Finalize(0, chunk_count, false);
+			}
+		}
+		for (auto &filter : sink.exact_filters) {
+			filter->ExactKeys().Finalize();
+		}
+		// consumers that did not wait for this pipeline start probing from here on
+		for (auto &filter : sink.op.bf_to_create) {
+			filter->Publish();
+		}
+	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
 };
@@ -319,44 +543,15 @@ SinkFinalizeType PhysicalCreateBF::Finalize(Pipeline &pipeline, Event &event, Cl
 	int64_t num_rows = 0;
 	const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 
-#ifdef External
-	auto num_partitions = sink.local_data_collections.size();
-	vector<idx_t> partition_sizes(num_partitions, 0);
-	vector<idx_t> partition_counts(num_partitions, 0);
-	for (int i = 0; i < sink.local_data_collections.size(); i++) {
-		D_ASSERT(partition_sizes.size() == sink.local_data_collections.size());
-		D_ASSERT(partition_sizes.size() == partition_counts.size());
-		partition_sizes[i] += sink.local_data_collections[i]->SizeInBytes();
-		partition_counts[i] += sink.local_data_collections[i]->Count();
-	}
-
-	idx_t total_size = 0;
-	idx_t total_count = 0;
-	sink.max_partition_size = 0;
-	sink.max_partition_count = 0;
-	for (idx_t i = 0; i < num_partitions; i++) {
-		total_size += partition_sizes[i];
-		total_count += partition_counts[i];
-		auto partition_size = partition_sizes[i];
-		if (partition_size > sink.max_partition_size) {
-			sink.max_partition_size = partition_sizes[i];
-			sink.max_partition_count = partition_counts[i];
+	if (sink.use_external) {
+		idx_t total_size = 0;
+		for (auto &partition : sink.local_tuple_collections) {
+			total_size += partition->SizeInBytes();
+			num_rows += partition->Count();
 		}
-	}
-
-	if (total_count == 0) {
-		total_size = 0;
-	}
-
-	sink.temporary_memory_state->SetRemainingSize(context, total_size);
-
-	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
-	if (sink.external) {
-		std::cout << "External Create BF" << std::endl;
-		if (num_threads > 1) {
-			throw InternalException("External CreateBF can only be used under single-thread.");
-		}
-		num_rows = total_count;
+		// the partitions stay separate, the buffer manager spills whatever exceeds the reservation
+		sink.temporary_memory_state->SetRemainingSize(context, total_size);
+		sink.external = sink.temporary_memory_state->GetReservation() < total_size;
 	} else {
 		for(auto& local_data : sink.local_data_collections) {
 			sink.total_data->Combine(*local_data);
@@ -364,42 +559,90 @@ SinkFinalizeType PhysicalCreateBF::Finalize(Pipeline &pipeline, Event &event, Cl
 		sink.local_data_collections.clear();
 		num_rows = sink.total_data->Count();
 	}
-#else
-	for(auto& local_data : sink.local_data_collections) {
-		sink.total_data->Combine(*local_data);
+
+	// the partition-locked parallel insert is opt-in: the finalize tasks hash in parallel and take turns inserting
+	sink.parallel_bloom_build = num_threads > 1 && ClientConfig::GetConfig(context).transfer_parallel_bloom_build;
+
+	// the key summaries let the probe side scans skip row groups and segments through their zonemaps
+	vector<value_set_t> key_sets(bf_to_create.size());
+	const bool collect_key_lists = num_rows <= (int64_t)TransferFilter::MAX_KEY_LIST_SIZE && !sink.external;
+	if (collect_key_lists) {
+		if (sink.use_external) {
+			for (auto &partition : sink.local_tuple_collections) {
+				DataChunk chunk;
+				TupleDataScanState state;
+				partition->InitializeChunk(chunk);
+				partition->InitializeScan(state);
+				while (partition->Scan(state, chunk)) {
+					CollectKeyLists(bf_to_create, key_sets, chunk);
+				}
+			}
+		} else {
+			for (auto &chunk : sink.total_data->Chunks()) {
+				CollectKeyLists(bf_to_create, key_sets, chunk);
+			}
+		}
+	}
+	for (idx_t i = 0; i < bf_to_create.size(); i++) {
+		auto &filter = bf_to_create[i];
+		filter->ResetKeySummary();
+		filter->ResetProbeStats();
+		if (sink.key_stats[i] && NumericStats::HasMinMax(*sink.key_stats[i])) {
+			filter->SetKeyRange(NumericStats::Min(*sink.key_stats[i]), NumericStats::Max(*sink.key_stats[i]));
+		}
+		if (filter->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+			// a range filter is nothing but the key range
+			filter->Cast<RangeFilter>().SetEmpty(num_rows == 0);
+			continue;
+		}
+		if (filter->GetFilterType() == TransferFilterType::BLOOM_FILTER) {
+			filter->Cast<BlockedBloomFilter>().SetEmpty(num_rows == 0);
+		}
+		if (collect_key_lists && filter->BoundColsBuilt.size() == 1) {
+			filter->SetKeyList(vector<Value>(key_sets[i].begin(), key_sets[i].end()));
+		}
+		// few or dense integer keys are held exactly, in place of the filter
+		if (filter->BoundColsBuilt.size() == 1 && ExactKeySet::SupportsType(types[filter->BoundColsBuilt[0]]) &&
+		    filter->HasKeyRange()) {
+			auto num_keys = MinValue<idx_t>(num_rows, sink.key_distinct[i]->GetCount());
+			auto exact_keys = ExactKeySet::Choose(filter->KeyMin().GetValue<int64_t>(),
+			                                      filter->KeyMax().GetValue<int64_t>(), num_keys);
+			if (exact_keys) {
+				filter->SetExactKeys(std::move(exact_keys));
+				sink.exact_filters.push_back(filter);
+			}
+		}
 	}
-	sink.local_data_collections.clear();
-	num_rows = sink.total_data->Count();
-#endif
 
-	for (auto &filter : bf_to_create) {
-		if (num_threads == 1) {
-#ifdef UseHashFilter
-			auto builder = make_shared<HashFilterBuilder_SingleThreaded>();
+	for (idx_t i = 0; i < bf_to_create.size(); i++) {
+		auto &filter = bf_to_create[i];
+		if (filter->GetFilterType() == TransferFilterType::RANGE_FILTER || filter->HasExactKeys()) {
+			continue;
+		}
+		if (filter->GetFilterType() == TransferFilterType::HASH_FILTER) {
 			auto cols = filter->BoundColsBuilt;
 			vector<LogicalType> layouts;
 			for(int i = 0; i < cols.size(); i++) {
-				layouts.emplace_back(sink.total_data.Types()[cols[i]]);
+				layouts.emplace_back(types[cols[i]]);
 			}
-			builder->Begin(1, arrow::internal::CpuInfo::AVX2, &BufferManager::GetBufferManager(context), layouts, 0, filter.get());
-#else
-			auto builder = make_shared<BloomFilterBuilder_SingleThreaded>();
-			builder->Begin(1, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), num_rows, 0, filter.get());
-#endif
-			sink.builders.emplace_back(builder);
+			shared_ptr<HashFilterBuilder> builder;
+			if (num_threads == 1) {
+				builder = make_shared<HashFilterBuilder_SingleThreaded>();
+			} else {
+				builder = make_shared<HashFilterBuilder_Parallel>();
+			}
+			builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, &BufferManager::GetBufferManager(context), layouts, 0, &filter->Cast<HashFilter>());
+			sink.hash_builders.emplace_back(builder);
 		} else {
-#ifdef UseHashFilter
-			auto builder = make_shared<HashFilterBuilder_Parallel>();
-			auto cols = filter->BoundColsBuilt;
-			vector<LogicalType> layouts;
-			for(int i = 0; i < cols.size(); i++) {
-				layouts.emplace_back(sink.total_data.Types()[cols[i]]);
+			shared_ptr<BloomFilterBuilder> builder;
+			if (!sink.parallel_bloom_build) {
+				builder = make_shared<BloomFilterBuilder_SingleThreaded>();
+			} else {
+				builder = make_shared<BloomFilterBuilder_Parallel>();
 			}
-			builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, &BufferManager::GetBufferManager(context), layouts, 0, filter.get());
-#else
-			auto builder = make_shared<BloomFilterBuilder_Parallel>();
-			builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), num_rows, 0, filter.get());
-#endif
+			// size the filter by the distinct keys, duplicates do not set any more bits
+			auto num_keys = MinValue<int64_t>(num_rows, sink.key_distinct[i]->GetCount());
+			builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), num_keys, 0, &filter->Cast<BlockedBloomFilter>());
 			sink.builders.emplace_back(builder);
 		}
 	}
@@ -418,6 +661,94 @@ unique_ptr<LocalSinkState> PhysicalCreateBF::GetLocalSinkState(ExecutionContext
 	return make_uniq<CreateBFLocalSinkState>(context.client, *this);
 }
 
+//===--------------------------------------------------------------------===//
+// Operator (streaming build)
+//===--------------------------------------------------------------------===//
+class CreateBFGlobalOperatorState : public GlobalOperatorState {
+public:
+	mutex glock;
+	vector<shared_ptr<BloomFilterBuilder>> builders;
+	//! Min/max of the build keys per filter, merged from the threads as they finish
+	vector<unique_ptr<BaseStatistics>> key_stats;
+};
+
+class CreateBFOperatorState : public OperatorState {
+public:
+	explicit CreateBFOperatorState(const PhysicalCreateBF &op) : key_stats(InitializeKeyStats(op)) {
+	}
+
+	vector<unique_ptr<BaseStatistics>> key_stats;
+	//! Rows this thread pushed to the builders
+	idx_t num_rows = 0;
+	//! Created with the first chunk, the builders live in the global state
+	unique_ptr<CreateBFBuildScratch> scratch;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalCreateBF::GetGlobalOperatorState(ClientContext &context) const {
+	auto state = make_uniq<CreateBFGlobalOperatorState>();
+	state->key_stats = InitializeKeyStats(*this);
+	// the build side is never materialized, so the filters are sized by the estimated cardinality
+	const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+	const int64_t num_keys = MaxValue<idx_t>(estimated_cardinality, 1);
+	for (auto &filter : bf_to_create) {
+		filter->ResetKeySummary();
+		filter->ResetProbeStats();
+		// until a thread reports rows in FinalExecute
+		filter->Cast<BlockedBloomFilter>().SetEmpty(true);
+		auto builder = make_shared<BloomFilterBuilder_Parallel>();
+		builder->Begin(num_threads, arrow::internal::CpuInfo::AVX2, arrow::default_memory_pool(), num_keys, 0, &filter->Cast<BlockedBloomFilter>());
+		state->builders.emplace_back(std::move(builder));
+	}
+	return std::move(state);
+}
+
+unique_ptr<OperatorState> PhysicalCreateBF::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<CreateBFOperatorState>(*this);
+}
+
+OperatorResultType PhysicalCreateBF::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                             GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<CreateBFGlobalOperatorState>();
+	auto &state = state_p.Cast<CreateBFOperatorState>();
+	auto thread_id = GetBuilderThreadId(context.client);
+	chunk.Reference(input);
+	if (!state.scratch) {
+		state.scratch = make_uniq<CreateBFBuildScratch>(types, gstate.builders, vector<shared_ptr<HashFilterBuilder>>());
+	}
+	if (hash_column_filter != DConstants::INVALID_INDEX) {
+		// the parent reuses these hashes, so compute them straight into the output
+		PushChunkToBloomBuilders(gstate.builders, *state.scratch, thread_id, input, hash_column_filter,
+		                         &chunk.data.back());
+	} else {
+		PushChunkToBloomBuilders(gstate.builders, *state.scratch, thread_id, input);
+	}
+	UpdateKeyRanges(*this, state.key_stats, input);
+	state.num_rows += input.size();
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalCreateBF::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                          GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<CreateBFGlobalOperatorState>();
+	auto &state = state_p.Cast<CreateBFOperatorState>();
+	lock_guard<mutex> lock(gstate.glock);
+	if (state.num_rows > 0) {
+		for (auto &filter : bf_to_create) {
+			filter->Cast<BlockedBloomFilter>().SetEmpty(false);
+		}
+	}
+	for (idx_t i = 0; i < state.key_stats.size(); i++) {
+		if (!state.key_stats[i]) {
+			continue;
+		}
+		gstate.key_stats[i]->Merge(*state.key_stats[i]);
+		if (NumericStats::HasMinMax(*gstate.key_stats[i])) {
+			bf_to_create[i]->SetKeyRange(NumericStats::Min(*gstate.key_stats[i]), NumericStats::Max(*gstate.key_stats[i]));
+		}
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -427,25 +758,29 @@ public:
 		: context(context) {
 		D_ASSERT(op.sink_state);
 		auto &gstate = op.sink_state->Cast<CreateBFGlobalSinkState>();
-#ifdef External
-		gstate.total_data->InitializeScan(scan_state);
-#else
-		gstate.total_data->InitializeScan(scan_state);
-#endif
+		use_external = gstate.use_external;
+		num_partitions = gstate.local_tuple_collections.size();
+		if (!use_external) {
+			gstate.total_data->InitializeScan(scan_state);
+		}
 		partition_id = 0;
 	}
 
-#ifdef External
-	TupleDataScanState scan_state;
-#else
 	ColumnDataParallelScanState scan_state;
-#endif
 	ClientContext &context;
 	vector<pair<idx_t, idx_t>> chunks_todo;
+	//! The next chunk range, or spillable partition, to be claimed by a thread
 	std::atomic<idx_t> partition_id;
+	bool use_external;
+	idx_t num_partitions;
 
 	idx_t MaxThreads() override {
-		return TaskScheduler::GetScheduler(context).NumberOfThreads();
+		auto num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		if (use_external) {
+			// every thread scans its own partitions
+			return MaxValue<idx_t>(MinValue<idx_t>(num_partitions, num_threads), 1);
+		}
+		return num_threads;
 	}
 };
 
@@ -456,6 +791,8 @@ public:
 		initial = true;
 	}
 	ColumnDataLocalScanState scan_state;
+	//! Scan of the spillable partition claimed last
+	TupleDataScanState tuple_scan_state;
 
 	idx_t local_current_chunk_id;
 	idx_t local_partition_id;
@@ -467,8 +804,7 @@ public:
 unique_ptr<GlobalSourceState> PhysicalCreateBF::GetGlobalSourceState(ClientContext &context) const {
 	auto state = make_uniq<CreateBFGlobalSourceState>(context, *this);
 	auto &gstate = sink_state->Cast<CreateBFGlobalSinkState>();
-#ifdef External
-	if(!gstate.external) {
+	if (!gstate.use_external) {
 		auto chunk_count = gstate.total_data->ChunkCount();
 		const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 		auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
@@ -483,21 +819,6 @@ unique_ptr<GlobalSourceState> PhysicalCreateBF::GetGlobalSourceState(ClientConte
 			chunk_idx = chunk_idx_to;
 		}
 	}
-#else
-	auto chunk_count = gstate.total_data->ChunkCount();
-	const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
-	auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
-	idx_t chunk_idx = 0;
-	for(idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
-		if (chunk_idx == chunk_count) {
-			break;
-		}
-		auto chunk_idx_from = chunk_idx;
-		auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
-		state->chunks_todo.emplace_back(chunk_idx_from, chunk_idx_to);
-		chunk_idx = chunk_idx_to;
-	}
-#endif
 	return unique_ptr_cast<CreateBFGlobalSourceState, GlobalSourceState>(std::move(state));
 }
 
@@ -511,32 +832,23 @@ SourceResultType PhysicalCreateBF::GetData(ExecutionContext &context, DataChunk
 	auto &gstate = sink_state->Cast<CreateBFGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<CreateBFLocalSourceState>();
 	auto &state = input.global_state.Cast<CreateBFGlobalSourceState>();
-#ifdef External
-	if (gstate.external) {
-		if(lstate.initial) {
-			lstate.local_partition_id = 0;
-			lstate.initial = false;
-			gstate.local_data_collections[lstate.local_partition_id]->InitializeScan(state.scan_state);
-		}
-		gstate.local_data_collections[lstate.local_partition_id]->Scan(state.scan_state, chunk);
-		if (chunk.size() == 0) {
-			lstate.local_partition_id++;
-			if (lstate.local_partition_id >= gstate.local_data_collections.size()) {
-				return SourceResultType::FINISHED;
+	if (gstate.use_external) {
+		// claim partitions until one still has rows, spilled blocks are read back as they are scanned
+		while (true) {
+			if (lstate.initial) {
+				lstate.local_partition_id = state.partition_id++;
+				if (lstate.local_partition_id >= state.num_partitions) {
+					return SourceResultType::FINISHED;
+				}
+				lstate.initial = false;
+				gstate.local_tuple_collections[lstate.local_partition_id]->InitializeScan(lstate.tuple_scan_state);
 			}
-			gstate.local_data_collections[lstate.local_partition_id]->InitializeScan(state.scan_state);
-		}
-	} else {
-		if (lstate.initial) {
-			lstate.initial = false;
-			gstate.total_data->InitializeScan(state.scan_state);
-		}
-		gstate.total_data->Scan(state.scan_state, chunk);
-		if(chunk.size() == 0) {
-			return SourceResultType::FINISHED;
+			if (gstate.local_tuple_collections[lstate.local_partition_id]->Scan(lstate.tuple_scan_state, chunk)) {
+				return SourceResultType::HAVE_MORE_OUTPUT;
+			}
+			lstate.initial = true;
 		}
 	}
-#else
 	if(lstate.initial) {
 		lstate.local_partition_id = state.partition_id++;
 		lstate.initial = false;
@@ -552,7 +864,6 @@ SourceResultType PhysicalCreateBF::GetData(ExecutionContext &context, DataChunk
 		return SourceResultType::FINISHED;
 	}
 	gstate.total_data->FetchChunk(lstate.local_current_chunk_id++, chunk);
-#endif
 	return SourceResultType::HAVE_MORE_OUTPUT;
 }
 
@@ -564,6 +875,15 @@ string PhysicalCreateBF::ParamsToString() const {
 void PhysicalCreateBF::BuildPipelinesFromRelated(Pipeline &current, MetaPipeline &meta_pipeline) {
 	op_state.reset();
 
+	if (ClientConfig::GetConfig(meta_pipeline.GetExecutor().context).transfer_pipelined) {
+		// no barrier: the pipeline is built where the operator sits in the plan, and `current` probes the filters
+		// once they are published
+		for (auto &filter : bf_to_create) {
+			filter->SetPipelined();
+		}
+		return;
+	}
+
 	auto &state = meta_pipeline.GetState();
 	// operator is a sink, build a pipeline
 	D_ASSERT(children.size() == 1);
@@ -578,11 +898,60 @@ void PhysicalCreateBF::BuildPipelinesFromRelated(Pipeline &current, MetaPipeline
 	}
 }
 
+bool PhysicalCreateBF::CanStream(Pipeline &current, MetaPipeline &meta_pipeline) const {
+	auto &config = ClientConfig::GetConfig(meta_pipeline.GetExecutor().context);
+	if (!config.transfer_streaming_build || config.transfer_pipelined) {
+		// a pipelined filter is published when the build side is finalized, which a streamed one never is
+		return false;
+	}
+	// a hash filter builds its pointer table after the last row, a Bloom filter is complete when the input ends
+	for (auto &filter : bf_to_create) {
+		if (filter->GetFilterType() != TransferFilterType::BLOOM_FILTER) {
+			return false;
+		}
+	}
+	// only right below the sink: then `current` finishes once the build side is consumed, and the operators that
+	// wait for the filters do not also wait for whatever the rest of the pipeline depends on
+	auto &state = meta_pipeline.GetState();
+	auto sink = state.GetPipelineSink(current);
+	if (!sink || !state.GetPipelineOperators(current).empty()) {
+		return false;
+	}
+	for (auto &child : sink->children) {
+		if (child.get() == this) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool PhysicalCreateBF::EmitHashColumn(const vector<idx_t> &key_columns) {
+	if (!streaming || hash_column_filter != DConstants::INVALID_INDEX) {
+		return false;
+	}
+	for (idx_t i = 0; i < bf_to_create.size(); i++) {
+		if (bf_to_create[i]->BoundColsBuilt == key_columns) {
+			hash_column_filter = i;
+			types.emplace_back(LogicalType::HASH);
+			return true;
+		}
+	}
+	return false;
+}
+
 /* Add related createBF dependency */
 void PhysicalCreateBF::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
 	op_state.reset();
 
 	auto &state = meta_pipeline.GetState();
+	if (this_pipeline == nullptr && CanStream(current, meta_pipeline)) {
+		// build the filters while the chunks flow through to the sink; UseBF operators depend on this pipeline
+		streaming = true;
+		this_pipeline = current.shared_from_this();
+		state.AddPipelineOperator(current, *this);
+		children[0]->BuildPipelines(current, meta_pipeline);
+		return;
+	}
 	// operator is a sink, build a pipeline
 	sink_state.reset();
 	D_ASSERT(children.size() == 1);
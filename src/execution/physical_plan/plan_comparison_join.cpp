@@ -196,6 +196,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 		                                   op.join_type, op.left_projection_map, op.right_projection_map,
 		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (ClientConfig::GetConfig(context).predicate_transfer_mode == PredicateTransferMode::BLOOM_JOIN) {
+			PushdownBloomJoinFilter(plan->Cast<PhysicalHashJoin>());
+		}
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
@@ -7,7 +7,7 @@
 namespace duckdb {
 PhysicalCreateBF* PhysicalPlanGenerator::CreatePlanfromRelated(LogicalCreateBF &op) {
     if(op.physical == nullptr) {
-        unique_ptr<PhysicalOperator> plan = CreatePlan(*op.children[0]);
+        unique_ptr<PhysicalOperator> plan = PlanTransferKeys(CreatePlan(*op.children[0]), op.bf_to_create, true);
         PhysicalCreateBF *create_bf = new PhysicalCreateBF(plan->types, op.bf_to_create, op.estimated_cardinality);
         create_bf->children.emplace_back(std::move(plan));
         op.physical = create_bf;
@@ -21,14 +21,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateBF &
     unique_ptr<PhysicalCreateBF> create_bf;
     unique_ptr<PhysicalOperator> plan;
     if(op.physical == nullptr) {
-        plan = CreatePlan(*op.children[0]);
+        plan = PlanTransferKeys(CreatePlan(*op.children[0]), op.bf_to_create, true);
         create_bf = make_uniq<PhysicalCreateBF>(plan->types, op.bf_to_create, op.estimated_cardinality);
         op.physical = create_bf.get();
         create_bf->children.emplace_back(std::move(plan));
     } else {
         create_bf = unique_ptr<PhysicalCreateBF>(op.physical);
     }
-    plan = std::move(create_bf);
-    return plan;
+    return PlanDropTransferKeys(std::move(create_bf), op.bf_to_create, true);
 }
 }
\ No newline at end of file
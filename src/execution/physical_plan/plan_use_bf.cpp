@@ -1,18 +1,212 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/operator/logical_use_bf.hpp"
 #include "duckdb/execution/operator/filter/physical_use_bf.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/filter/transfer_table_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
+static const vector<unique_ptr<Expression>> &TransferKeys(TransferFilter &filter, bool built) {
+    return built ? filter.expressions_built_ : filter.expressions_applied_;
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanTransferKeys(unique_ptr<PhysicalOperator> plan,
+                                                                     const vector<shared_ptr<TransferFilter>> &filters, bool built) {
+    vector<LogicalType> types = plan->types;
+    vector<unique_ptr<Expression>> select_list;
+    for (idx_t i = 0; i < plan->types.size(); i++) {
+        select_list.push_back(make_uniq<BoundReferenceExpression>(plan->types[i], i));
+    }
+    // the same order the ColumnBindingResolver bound the keys in
+    for (auto &filter : filters) {
+        for (auto &key : TransferKeys(*filter, built)) {
+            types.push_back(key->return_type);
+            select_list.push_back(key->Copy());
+        }
+    }
+    if (types.size() == plan->types.size()) {
+        return plan;
+    }
+    auto projection = make_uniq<PhysicalProjection>(std::move(types), std::move(select_list), plan->estimated_cardinality);
+    projection->children.push_back(std::move(plan));
+    return std::move(projection);
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanDropTransferKeys(unique_ptr<PhysicalOperator> plan,
+                                                                         const vector<shared_ptr<TransferFilter>> &filters, bool built) {
+    idx_t key_count = 0;
+    for (auto &filter : filters) {
+        key_count += TransferKeys(*filter, built).size();
+    }
+    if (key_count == 0) {
+        return plan;
+    }
+    vector<LogicalType> types;
+    vector<unique_ptr<Expression>> select_list;
+    for (idx_t i = 0; i + key_count < plan->types.size(); i++) {
+        types.push_back(plan->types[i]);
+        select_list.push_back(make_uniq<BoundReferenceExpression>(plan->types[i], i));
+    }
+    auto projection = make_uniq<PhysicalProjection>(std::move(types), std::move(select_list), plan->estimated_cardinality);
+    projection->children.push_back(std::move(plan));
+    return std::move(projection);
+}
+
+/* Whether the rows of a hash join keep the columns of its probe side at the same positions, and a probe row dropped
+ * below the join only drops the join results that carry its values */
+static bool KeepsProbeColumns(PhysicalOperator &op) {
+    if (op.type != PhysicalOperatorType::HASH_JOIN || op.children[0]->type == PhysicalOperatorType::USE_BF) {
+        // a UseBF below the join appends a HASH column the join consumes
+        return false;
+    }
+    switch (op.Cast<PhysicalHashJoin>().join_type) {
+    case JoinType::INNER:
+    case JoinType::LEFT:
+    case JoinType::SEMI:
+    case JoinType::ANTI:
+    case JoinType::MARK:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* The base table scan the filters can be pushed into, if any. `columns` maps the columns of `plan` to the columns of
+ * the scan output, INVALID_INDEX for the ones computed on the way. With `through_joins` the scan may also lie on the
+ * probe side of hash joins below `plan` */
+static optional_ptr<PhysicalTableScan> GetPushdownScan(PhysicalOperator &plan, vector<idx_t> &columns,
+                                                       bool through_joins = false) {
+    auto op = &plan;
+    columns.clear();
+    for (idx_t i = 0; i < plan.types.size(); i++) {
+        columns.push_back(i);
+    }
+    while (true) {
+        if (op->type == PhysicalOperatorType::PROJECTION) {
+            // e.g. the branches of a set operation, whose columns are cast and reordered by a projection
+            auto &projection = op->Cast<PhysicalProjection>();
+            for (auto &col : columns) {
+                if (col == DConstants::INVALID_INDEX) {
+                    continue;
+                }
+                auto &expr = *projection.select_list[col];
+                col = expr.type == ExpressionType::BOUND_REF ? expr.Cast<BoundReferenceExpression>().index
+                                                             : DConstants::INVALID_INDEX;
+            }
+        } else if (op->type == PhysicalOperatorType::FILTER) {
+            // a filter keeps the columns of its child, so the bound columns still refer to the scan output
+        } else if (through_joins && KeepsProbeColumns(*op)) {
+            // the build side columns follow the probe side columns
+            auto probe_column_count = op->children[0]->types.size();
+            for (auto &col : columns) {
+                if (col >= probe_column_count) {
+                    col = DConstants::INVALID_INDEX;
+                }
+            }
+        } else {
+            break;
+        }
+        op = op->children[0].get();
+    }
+    if (op->type != PhysicalOperatorType::TABLE_SCAN) {
+        return nullptr;
+    }
+    auto &scan = op->Cast<PhysicalTableScan>();
+    if (!scan.function.filter_pushdown) {
+        return nullptr;
+    }
+    // scans that evaluate TransferTableFilter rows and prune row groups with its key summary
+    auto &name = scan.function.name;
+    if (name != "seq_scan" && name != "parquet_scan" && name != "read_parquet") {
+        return nullptr;
+    }
+    return &scan;
+}
+
+/* Nested columns are scanned through their children and cannot evaluate table filters */
+static bool IsPushdownKeyType(const LogicalType &type) {
+    switch (type.InternalType()) {
+    case PhysicalType::STRUCT:
+    case PhysicalType::LIST:
+    case PhysicalType::ARRAY:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/* Move single-column filters into the table scan, return the filters that still have to be probed by UseBF */
+static vector<shared_ptr<TransferFilter>> PushdownIntoScan(PhysicalTableScan &scan, const vector<idx_t> &columns,
+                                                           vector<shared_ptr<TransferFilter>> &filters) {
+    vector<shared_ptr<TransferFilter>> remaining;
+    for (auto &filter : filters) {
+        // expression keys are evaluated above the scan
+        if (filter->BoundColsApplied.size() != 1 || !filter->expressions_applied_.empty()) {
+            remaining.emplace_back(filter);
+            continue;
+        }
+        auto col = columns[filter->BoundColsApplied[0]];
+        if (col == DConstants::INVALID_INDEX) {
+            remaining.emplace_back(filter);
+            continue;
+        }
+        auto scan_col = scan.projection_ids.empty() ? col : scan.projection_ids[col];
+        auto column_id = scan.column_ids[scan_col];
+        if (column_id == COLUMN_IDENTIFIER_ROW_ID || !IsPushdownKeyType(scan.returned_types[column_id])) {
+            remaining.emplace_back(filter);
+            continue;
+        }
+        if (!scan.table_filters) {
+            scan.table_filters = make_uniq<TableFilterSet>();
+        }
+        scan.table_filters->PushFilter(scan_col, make_uniq<TransferTableFilter>(filter));
+    }
+    return remaining;
+}
+
+void PhysicalPlanGenerator::PushdownBloomJoinFilter(PhysicalHashJoin &join) {
+    // the scan may only drop the probe rows without a match, and hashes a single key column like the hash table
+    vector<idx_t> build_columns;
+    vector<idx_t> probe_columns;
+    if (!join.EmptyResultIfRHSIsEmpty() || !join.GetEqualityKeyColumns(build_columns, probe_columns) ||
+        probe_columns.size() != 1) {
+        return;
+    }
+    vector<idx_t> columns;
+    auto scan = GetPushdownScan(*join.children[0], columns, true);
+    if (!scan) {
+        return;
+    }
+    join.bloomfilter->BoundColsApplied = probe_columns;
+    vector<shared_ptr<TransferFilter>> filters {join.bloomfilter};
+    if (!PushdownIntoScan(*scan, columns, filters).empty()) {
+        return;
+    }
+    // the filter is only built for in-memory joins that do not use a perfect hash table: the scan lets every row pass
+    // until the join publishes it
+    join.bloomfilter->SetPipelined();
+    join.bloom_filter_pushed_down = true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalUseBF &op) {
     unique_ptr<PhysicalOperator> plan = CreatePlan(*op.children[0]);
-    auto use_bf = make_uniq<PhysicalUseBF>(plan->types, op.bf_to_use, op.estimated_cardinality);
+    auto filters = op.bf_to_use;
+    vector<idx_t> columns;
+    auto scan = GetPushdownScan(*plan, columns);
+    if (scan) {
+        filters = PushdownIntoScan(*scan, columns, filters);
+    }
+    plan = PlanTransferKeys(std::move(plan), op.bf_to_use, false);
+    // UseBF stays in the plan even without filters: it carries the dependencies on the CreateBF pipelines
+    auto use_bf = make_uniq<PhysicalUseBF>(plan->types, filters, op.estimated_cardinality);
     use_bf->children.emplace_back(std::move(plan));
     for(auto cell : op.related_create_bf) {
         use_bf->related_create_bf.emplace_back(CreatePlanfromRelated(*cell));
     }
-    plan = std::move(use_bf);
-    return plan;
+    return PlanDropTransferKeys(std::move(use_bf), op.bf_to_use, false);
 }
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/predicate_transfer_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class PredicateTransferMode : uint8_t {
+	//! Neither predicate transfer nor sideways Bloom joins
+	NONE = 0,
+	//! Insert CreateBF/UseBF operators along the transfer DAG
+	PREDICATE_TRANSFER,
+	//! Build a Bloom filter inside every hash join and probe it before the hash table
+	BLOOM_JOIN
+};
+
+enum class BloomJoinFilterMode : uint8_t {
+	//! Built unless the hash table fits the last level cache and the filter only guards the hash join probe
+	AUTO = 0,
+	//! Built for every in-memory hash join
+	ALWAYS,
+	//! Never built
+	NEVER
+};
+
+enum class TransferFilterType : uint8_t {
+	//! Approximate membership with a blocked Bloom filter
+	BLOOM_FILTER = 0,
+	//! Exact membership with a hash table on the build keys
+	HASH_FILTER,
+	//! Lower or upper bound of the build keys, transferred along inequality join conditions
+	RANGE_FILTER
+};
+
+enum class BloomFilterLayout : uint8_t {
+	//! Chosen per filter from its size and target false positive rate
+	AUTO = 0,
+	//! One 64-bit block per key with a few bits set, the cheapest probe
+	REGISTER_BLOCKED,
+	//! One 256-bit block per key with a bit in each 32-bit word, the lower false positive rate
+	SECTORIZED
+};
+
+enum class TransferOrderStrategy : uint8_t {
+	//! Repeatedly root a spanning tree at the largest remaining relation
+	LARGEST_ROOT = 0,
+	//! Transfer strictly from the smallest to the largest relation
+	SMALL_TO_LARGE,
+	//! Root a spanning tree at the largest relation and attach the others level by level, keeping it shallow
+	BUSHY
+};
+
+enum class JoinOrderAlgorithm : uint8_t {
+	//! Dynamic programming / greedy enumeration of bushy plans
+	DYNAMIC_PROGRAMMING = 0,
+	//! Exhaustive enumeration of left-deep plans
+	EXACT_LEFT_DEEP,
+	//! Random bushy plan
+	RANDOM_BUSHY,
+	//! Random left-deep plan
+	RANDOM_LEFT_DEEP
+};
+
+} // namespace duckdb
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/adaptive_transfer_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/vector_size.hpp"
+
+namespace duckdb {
+
+//! Orders the predicate transfer filters probed by one operator based on the pass rate and the cost per tuple
+//! observed at runtime, and switches off filters that hardly remove any rows
+class AdaptiveTransferFilter {
+public:
+	explicit AdaptiveTransferFilter(idx_t filter_count);
+
+	//! Record that filter `idx` kept `rows_out` of `rows_in` rows in `duration` seconds
+	void Update(idx_t idx, idx_t rows_in, idx_t rows_out, double duration);
+	//! Called once per chunk; re-ranks the filters every adapt_interval chunks
+	void AdaptRuntimeStatistics();
+
+	bool IsDisabled(idx_t idx) const {
+		return stats[idx].disabled;
+	}
+
+	//! The order in which the filters should be probed
+	vector<idx_t> permutation;
+
+	//! Number of chunks between two re-rankings
+	static constexpr const idx_t ADAPT_INTERVAL = 16;
+	//! Filters that keep more than this fraction of their input rows are disabled
+	static constexpr const double DISABLE_PASS_RATE = 0.95;
+	//! Rows a filter must have seen before it can be disabled
+	static constexpr const idx_t DISABLE_MIN_ROWS = 16 * STANDARD_VECTOR_SIZE;
+
+private:
+	struct FilterStatistics {
+		idx_t rows_in = 0;
+		idx_t rows_out = 0;
+		double runtime = 0;
+		bool disabled = false;
+	};
+
+	//! Expected cost of a filter per row it removes; cheap and selective filters go first. Only defined for filters
+	//! that have seen rows
+	double Rank(const FilterStatistics &filter_stats) const;
+
+	vector<FilterStatistics> stats;
+	idx_t chunk_count;
+};
+
+} // namespace duckdb
@@ -119,8 +119,9 @@ public:
 	              vector<LogicalType> build_types, JoinType type, const vector<idx_t> &output_columns);
 	~JoinHashTable();
 
-	//! Add the given data to the HT
-	void Build(PartitionedTupleDataAppendState &append_state, DataChunk &keys, DataChunk &input);
+	//! Add the given data to the HT, reusing the hashes of the keys if they were already computed
+	void Build(PartitionedTupleDataAppendState &append_state, DataChunk &keys, DataChunk &input,
+	           Vector *precomputed_hashes = nullptr);
 	//! Merge another HT into this one
 	void Merge(JoinHashTable &other);
 	//! Combines the partitions in sink_collection into data_collection, as if it were not partitioned
@@ -190,6 +191,39 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Probe rows between prefetching a pointer table entry and loading it
+	static constexpr const idx_t PROBE_PREFETCH_DISTANCE = 16;
+
+	//! The entries of the pointer table keep the row pointer in their lower 48 bits, the upper 16 bits are a salt:
+	//! every row in the chain of the entry sets one of them, chosen by the top 4 bits of its hash. A probe whose bit is
+	//! not set skips the chain without reading any row. Pointers without 16 spare bits, i.e. on 32-bit platforms, are
+	//! kept unsalted.
+	static constexpr const bool SALT_ENTRIES = sizeof(uintptr_t) == sizeof(uint64_t);
+	static constexpr const idx_t SALT_SHIFT = 48;
+	static constexpr const uintptr_t POINTER_MASK =
+	    SALT_ENTRIES ? uintptr_t((uint64_t(1) << SALT_SHIFT) - 1) : ~uintptr_t(0);
+
+	static inline uintptr_t HashSalt(hash_t hash) {
+		return SALT_ENTRIES ? uintptr_t(uint64_t(1) << (SALT_SHIFT + (hash >> 60))) : 0;
+	}
+	static inline data_ptr_t EntryPointer(data_ptr_t entry) {
+		return reinterpret_cast<data_ptr_t>(reinterpret_cast<uintptr_t>(entry) & POINTER_MASK);
+	}
+	static inline uintptr_t EntrySalt(data_ptr_t entry) {
+		return reinterpret_cast<uintptr_t>(entry) & ~POINTER_MASK;
+	}
+	//! Whether the chain of `entry` may hold the key of the probe entry `probe`
+	static inline bool SaltMatches(data_ptr_t entry, data_ptr_t probe) {
+		return !SALT_ENTRIES || (EntrySalt(entry) & EntrySalt(probe)) != 0;
+	}
+	//! The entry of a chain with `row` in front of the chain of `entry`
+	static inline data_ptr_t PrependEntry(data_ptr_t row, data_ptr_t entry, uintptr_t salt) {
+		if (SALT_ENTRIES && (reinterpret_cast<uintptr_t>(row) & ~POINTER_MASK) != 0) {
+			// the salt would corrupt the address: allocations above 2^48, e.g. with 5-level paging or tagged pointers
+			throw InternalException("Hash join address uses the upper 16 bits that are reserved for the salt");
+		}
+		return reinterpret_cast<data_ptr_t>(reinterpret_cast<uintptr_t>(row) | EntrySalt(entry) | salt);
+	}
 
 	struct {
 		mutex mj_lock;
@@ -213,8 +247,7 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
+	//! Point `pointers` at the pointer table entries of the hashes, tagged with the salt of the hashes
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
@@ -331,7 +364,7 @@ public:
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	unique_ptr<ScanStructure> ProbeAndSpill(DataChunk &keys, TupleDataChunkState &key_state, DataChunk &payload,
 	                                        ProbeSpill &probe_spill, ProbeSpillLocalAppendState &spill_state,
-	                                        DataChunk &spill_chunk);
+	                                        DataChunk &spill_chunk, Vector *precomputed_hashes = nullptr);
 
 private:
 	//! The current number of radix bits used to partition
@@ -11,20 +11,15 @@ public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::USE_BF;
 
 public:
-#ifdef UseHashFilter
-	PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<HashFilter>> bf, idx_t estimated_cardinality);
-#else
-	PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<BlockedBloomFilter>> bf, idx_t estimated_cardinality);
-#endif
-
-#ifdef UseHashFilter
-	vector<shared_ptr<HashFilter>> bf_to_use;
-#else
-	vector<shared_ptr<BlockedBloomFilter>> bf_to_use;
-#endif
+	PhysicalUseBF(vector<LogicalType> types, vector<shared_ptr<TransferFilter>> bf, idx_t estimated_cardinality);
+
+	vector<shared_ptr<TransferFilter>> bf_to_use;
 
 	vector<PhysicalCreateBF *> related_create_bf;
 
+	//! The key columns whose hashes are appended to the output as a trailing HASH column (empty if none)
+	vector<idx_t> hash_column_keys;
+
 public:
 	/* Operator interface */
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
@@ -37,6 +32,10 @@ public:
 
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 
+	//! Append the hashes of `key_columns` to the output, so that the parent does not hash them again.
+	//! Only possible when one of the Bloom filters is applied on exactly these columns.
+	bool EmitHashColumn(const vector<idx_t> &key_columns);
+
 protected:
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
@@ -15,10 +15,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/operator/logical_join.hpp"
 
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
-#ifdef BloomJoin
 #include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter.hpp"
-#endif
 
 namespace duckdb {
 
@@ -57,10 +54,23 @@ public:
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
 
-#ifdef BloomJoin
+	//! Bloom filter on the build keys, probed before the hash table when predicate_transfer_mode is bloom_join
 	shared_ptr<BloomFilterBuilder> builder;
 	shared_ptr<BlockedBloomFilter> bloomfilter = make_shared<BlockedBloomFilter>();
-#endif
+	//! Whether the Bloom filter is probed by the table scan of the probe side instead of by the join
+	bool bloom_filter_pushed_down = false;
+
+	//! Position of the HASH column of the join keys appended by a CreateBF below the build side (if any)
+	idx_t build_hash_column = DConstants::INVALID_INDEX;
+	//! Position of the HASH column of the join keys appended by a UseBF below the probe side (if any)
+	idx_t probe_hash_column = DConstants::INVALID_INDEX;
+
+	//! A key-only build keeps dropping duplicate keys while at most this fraction of its rows has a new key
+	static constexpr const double DISTINCT_BUILD_MAX_PASS_RATE = 0.8;
+	//! Rows a thread must have seen before it gives up dropping duplicate keys
+	static constexpr const idx_t DISTINCT_BUILD_MIN_ROWS = 16 * STANDARD_VECTOR_SIZE;
+	//! Distinct keys a thread keeps at most to find duplicates
+	static constexpr const idx_t DISTINCT_BUILD_MAX_KEYS = 1 << 20;
 
 public:
 	// Operator Interface
@@ -108,6 +118,15 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+
+	//! The columns of the build and probe input hashed by the hash table, if all equality keys are plain references
+	bool GetEqualityKeyColumns(vector<idx_t> &build_columns, vector<idx_t> &probe_columns) const;
+	//! Whether the hash table only stores the keys and the result only depends on which keys exist (semi, anti and
+	//! mark joins), so that the build can drop duplicate keys
+	bool DistinctKeyBuild() const;
 };
 
 } // namespace duckdb
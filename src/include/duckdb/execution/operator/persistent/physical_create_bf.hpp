@@ -14,20 +14,36 @@ public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_BF;
 
 public:
-#ifdef UseHashFilter
-	PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<HashFilter>> bf, idx_t estimated_cardinality);
-#else
-	PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<BlockedBloomFilter>> bf, idx_t estimated_cardinality);
-#endif
-
-#ifdef UseHashFilter
-	vector<shared_ptr<HashFilter>> bf_to_create;
-#else
-	vector<shared_ptr<BlockedBloomFilter>> bf_to_create;
-#endif
+	PhysicalCreateBF(vector<LogicalType> types, vector<shared_ptr<TransferFilter>> bf, idx_t estimated_cardinality);
+
+	vector<shared_ptr<TransferFilter>> bf_to_create;
 
 	shared_ptr<Pipeline> this_pipeline;
 
+	//! Whether the filters are built while the chunks stream through to the parent, instead of materializing the
+	//! build side first (decided when the pipelines are built)
+	bool streaming = false;
+
+	//! The filter whose key hashes are appended to the streamed chunks as a trailing HASH column (if any)
+	idx_t hash_column_filter = DConstants::INVALID_INDEX;
+
+public:
+	// Operator interface (streaming build)
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	bool RequiresFinalExecute() const override {
+		return streaming;
+	}
+
 public:
 	// Source interface
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
@@ -38,7 +54,7 @@ public:
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
 
 	bool IsSource() const override {
-		return true;
+		return !streaming;
 	}
 
 	bool ParallelSource() const override {
@@ -51,8 +67,6 @@ public:
 	
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 
-	bool LoadInMem(idx_t num_partitions, idx_t max_partition_size, CreateBFGlobalSinkState &sink) const;
-
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context, OperatorSinkFinalizeInput &input) const override;
 
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
@@ -60,7 +74,7 @@ public:
 	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 
 	bool IsSink() const override {
-		return true;
+		return !streaming;
 	}
 
 	bool ParallelSink() const override {
@@ -73,7 +87,14 @@ public:
 
 	void BuildPipelinesFromRelated(Pipeline &current, MetaPipeline &meta_pipeline);
 
+	//! Append the hashes of `key_columns` to the streamed chunks, so that the parent does not hash them again.
+	//! Only possible when streaming and one of the filters is built on exactly these columns.
+	bool EmitHashColumn(const vector<idx_t> &key_columns);
+
 private:
+	//! Whether the filters can be built inside `current`, right below its sink
+	bool CanStream(Pipeline &current, MetaPipeline &meta_pipeline) const;
+
     idx_t counter = 0;
 	shared_ptr<idx_t> count_for_debug;
 };
@@ -20,6 +20,8 @@
 
 namespace duckdb {
 class PhysicalCreateBF;
+class PhysicalHashJoin;
+class TransferFilter;
 class ClientContext;
 class ColumnDataCollection;
 
@@ -105,6 +107,14 @@ protected:
 	                                                         vector<unique_ptr<Expression>> &expressions,
 	                                                         vector<unique_ptr<Expression>> &groups);
 	PhysicalCreateBF* CreatePlanfromRelated(LogicalCreateBF &op);
+	//! Append the expression keys of transfer filters (built or applied side) as columns to the plan
+	static unique_ptr<PhysicalOperator> PlanTransferKeys(unique_ptr<PhysicalOperator> plan,
+	                                                     const vector<shared_ptr<TransferFilter>> &filters, bool built);
+	//! Project away the columns appended by PlanTransferKeys
+	static unique_ptr<PhysicalOperator> PlanDropTransferKeys(unique_ptr<PhysicalOperator> plan,
+	                                                         const vector<shared_ptr<TransferFilter>> &filters, bool built);
+	//! Let the table scan of the probe side probe the Bloom filter of a hash join (predicate_transfer_mode = bloom_join)
+	static void PushdownBloomJoinFilter(PhysicalHashJoin &join);
 
 private:
 	bool PreserveInsertionOrder(PhysicalOperator &plan);
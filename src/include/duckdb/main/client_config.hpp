@@ -11,6 +11,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/enums/predicate_transfer_mode.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
@@ -75,6 +76,33 @@ struct ClientConfig {
 	bool force_asof_iejoin = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Whether to run predicate transfer, sideways Bloom joins, or neither
+	PredicateTransferMode predicate_transfer_mode = PredicateTransferMode::PREDICATE_TRANSFER;
+	//! When hash joins build their Bloom filter in bloom_join mode
+	BloomJoinFilterMode bloom_join_filter_mode = BloomJoinFilterMode::AUTO;
+	//! The membership filter built by CreateBF operators
+	TransferFilterType transfer_filter_type = TransferFilterType::BLOOM_FILTER;
+	//! How the predicate transfer DAG is ordered
+	TransferOrderStrategy transfer_order_strategy = TransferOrderStrategy::LARGEST_ROOT;
+	//! Allow CreateBF to keep its materialized input in partitions that can be spilled
+	bool transfer_external = false;
+	//! Build Bloom filters while the build side streams through to its parent, where possible
+	bool transfer_streaming_build = true;
+	//! Insert the keys of materialized Bloom filter builds from all threads under partition locks, instead of one
+	//! chunk at a time through the single-threaded builder
+	bool transfer_parallel_bloom_build = false;
+	//! The false positive rate Bloom filters are sized for
+	double transfer_false_positive_rate = 0.02;
+	//! The block layout of Bloom filters
+	BloomFilterLayout transfer_bloom_layout = BloomFilterLayout::AUTO;
+	//! How many rows ahead large Bloom filters prefetch the blocks they probe
+	idx_t transfer_prefetch_distance = 32;
+	//! Let the consumers of transfer filters run without waiting for the filters to be built
+	bool transfer_pipelined = false;
+	//! Transfer edges must remove at least this fraction of the rows they build and probe (0 keeps every edge)
+	double transfer_min_benefit = 0.1;
+	//! The join enumeration algorithm used by the join order optimizer
+	JoinOrderAlgorithm join_order_algorithm = JoinOrderAlgorithm::DYNAMIC_PROGRAMMING;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
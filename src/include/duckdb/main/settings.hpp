@@ -105,6 +105,136 @@ struct PreferRangeJoins {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct JoinOrderAlgorithmSetting {
+	static constexpr const char *Name = "join_order_algorithm";
+	static constexpr const char *Description =
+	    "The join enumeration algorithm (dynamic_programming, exact_left_deep, random_bushy or random_left_deep)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferModeSetting {
+	static constexpr const char *Name = "predicate_transfer_mode";
+	static constexpr const char *Description =
+	    "How join predicates are transferred between tables (predicate_transfer, bloom_join or none)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferBloomJoinFilterSetting {
+	static constexpr const char *Name = "predicate_transfer_bloom_join_filter";
+	static constexpr const char *Description =
+	    "When hash joins build their Bloom filter in bloom_join mode (auto, always or never)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferFilterSetting {
+	static constexpr const char *Name = "predicate_transfer_filter";
+	static constexpr const char *Description =
+	    "The membership filter built for predicate transfer (bloom or hash)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferOrderSetting {
+	static constexpr const char *Name = "predicate_transfer_order";
+	static constexpr const char *Description =
+	    "How the predicate transfer graph is ordered (largest_root, small_to_large or bushy)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferExternalSetting {
+	static constexpr const char *Name = "predicate_transfer_external";
+	static constexpr const char *Description =
+	    "Allow the input materialized for predicate transfer filters to be partitioned for out-of-core processing";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferStreamingBuildSetting {
+	static constexpr const char *Name = "predicate_transfer_streaming_build";
+	static constexpr const char *Description =
+	    "Build Bloom filters while the build side streams to its parent, when nothing has to wait for the filters";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferParallelBloomBuildSetting {
+	static constexpr const char *Name = "predicate_transfer_parallel_bloom_build";
+	static constexpr const char *Description =
+	    "Insert Bloom filter keys from all threads under partition locks instead of through a single-threaded builder";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferFalsePositiveRateSetting {
+	static constexpr const char *Name = "predicate_transfer_false_positive_rate";
+	static constexpr const char *Description =
+	    "The false positive rate Bloom filters are sized for, before cache size limits are applied";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferBloomLayoutSetting {
+	static constexpr const char *Name = "predicate_transfer_bloom_layout";
+	static constexpr const char *Description =
+	    "The block layout of Bloom filters (auto, register_blocked or sectorized)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferPipelinedSetting {
+	static constexpr const char *Name = "predicate_transfer_pipelined";
+	static constexpr const char *Description =
+	    "Start the pipelines probing transfer filters without waiting for them; rows pass until a filter is built";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferPrefetchDistanceSetting {
+	static constexpr const char *Name = "predicate_transfer_prefetch_distance";
+	static constexpr const char *Description =
+	    "How many rows ahead large Bloom filters prefetch the blocks they probe (0 disables prefetching)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct PredicateTransferMinBenefitSetting {
+	static constexpr const char *Name = "predicate_transfer_min_benefit";
+	static constexpr const char *Description =
+	    "Skip transfer edges expected to remove fewer rows than this fraction of the rows they build and probe";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
@@ -14,6 +14,7 @@
 #include "duckdb/planner/column_binding.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/optimizer/predicate_transfer/bloom_filter/partition_util.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_filter.hpp"
 
 namespace duckdb {
 
@@ -83,6 +84,63 @@ struct BloomFilterMasks {
   uint8_t masks_[kTotalBytes];
 };
 
+// Block layouts of BlockedBloomFilter. A layout fixes the size of a block
+// and which bits of it a hash sets; the probe and insert kernels are
+// instantiated per layout. Every layout picks the block from the hash bits
+// starting at kBlockIdBitOffset, which the parallel builder partitions on.
+//
+static constexpr int kBlockIdBitOffset = BloomFilterMasks::kLogNumMasks + 6;
+
+// A 64-bit block that receives a mask of 4-5 bits, taken from
+// BloomFilterMasks and rotated. A probe reads one word, but all keys of a
+// block share its 64 bits.
+//
+struct RegisterBlockedLayout {
+  static constexpr int kLogBlockBits = 6;
+  static constexpr int kWordsPerBlock = 1;
+
+  static inline uint64_t Mask(const BloomFilterMasks& masks, uint64_t hash, int /*word*/) {
+    // The lowest bits of hash are used to pick mask index.
+    //
+    int mask_id = static_cast<int>(hash & (BloomFilterMasks::kNumMasks - 1));
+    uint64_t result = const_cast<BloomFilterMasks&>(masks).mask(mask_id);
+
+    // The next set of hash bits is used to pick the amount of bit
+    // rotation of the mask.
+    //
+    int rotation = (hash >> BloomFilterMasks::kLogNumMasks) & 63;
+    return ROTL64(result, rotation);
+  }
+};
+
+// A 256-bit block of eight 32-bit words with one bit set in each, as in the
+// split block Bloom filter of Parquet. A probe reads half a cache line, and
+// from about 10 bits per key on the false positive rate is lower than with
+// register blocking.
+//
+struct SectorizedLayout {
+  static constexpr int kLogBlockBits = 8;
+  static constexpr int kWordsPerBlock = 4;
+
+  // The bit within 32-bit word i is the top 5 bits of key * kSalt[i]
+  static constexpr uint32_t kSalt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+  // The in-block bits come from a remix of the whole hash, so that they do
+  // not repeat the bits that picked the block
+  static inline uint32_t Key(uint64_t hash) {
+    return static_cast<uint32_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32);
+  }
+
+  // The bits of 64-bit word `word`, i.e. of 32-bit words 2 * word and 2 * word + 1
+  static inline uint64_t Mask(const BloomFilterMasks& /*masks*/, uint64_t hash, int word) {
+    uint32_t key = Key(hash);
+    uint64_t lo = 1ULL << ((key * kSalt[2 * word]) >> 27);
+    uint64_t hi = 1ULL << ((key * kSalt[2 * word + 1]) >> 27);
+    return lo | (hi << 32);
+  }
+};
+
 // A variant of a blocked Bloom filter implementation.
 // A Bloom filter is a data structure that provides approximate membership test
 // functionality based only on the hash of the key. Membership test may return
@@ -96,57 +154,65 @@ struct BloomFilterMasks {
 // good balance between the size of the filter, the cost of its building and
 // querying and the rate of false positives.
 //
-class BlockedBloomFilter {
+class BlockedBloomFilter : public TransferFilter {
   friend class BloomFilterBuilder_SingleThreaded;
   friend class BloomFilterBuilder_Parallel;
 
 public:
   BlockedBloomFilter()
-    : private_masks_(nullptr), log_num_blocks_(0), num_blocks_(0),
-    blocks_(nullptr), use_64bit_hashes_(true), Used_(false) {}
+    : TransferFilter(TransferFilterType::BLOOM_FILTER), private_masks_(nullptr), log_num_blocks_(0), num_blocks_(0),
+    use_64bit_hashes_(true), blocks_(nullptr) {}
   BlockedBloomFilter(int log_num_blocks, bool use_64bit_hashes) :
+    TransferFilter(TransferFilterType::BLOOM_FILTER),
     log_num_blocks_(log_num_blocks), num_blocks_(1ULL << log_num_blocks_),
-    use_64bit_hashes_(use_64bit_hashes), Used_(false) {}
-
-  void AddColumnBindingApplied(ColumnBinding column_binding) {
-    column_bindings_applied_.emplace_back(column_binding);
-  }
-
-  void AddColumnBindingBuilt(ColumnBinding column_binding) {
-    column_bindings_built_.emplace_back(column_binding);
-  }
+    use_64bit_hashes_(use_64bit_hashes) {}
 
   inline bool Find(uint64_t hash) const {
-    uint64_t m = mask(hash);
-    uint64_t b = blocks_[block_id(hash)];
-    return (b & m) == m;
+    if (layout_ == BloomFilterLayout::SECTORIZED) {
+      return FindHash<SectorizedLayout>(hash);
+    }
+    return FindHash<RegisterBlockedLayout>(hash);
   }
 
-  // Uses SIMD if available for smaller Bloom filters.
-  // Uses memory prefetching for larger Bloom filters.
+  // Uses gather-based SIMD lookups if available (AVX-512 when compiled in,
+  // AVX2 otherwise). Filters larger than kPrefetchLimitBytes additionally
+  // prefetch the blocks of the hashes prefetch_distance() rows ahead.
   //
   void Find(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes,
             SelectionVector &sel, idx_t &result_count, bool enable_prefetch = true) const;
 
-  vector<ColumnBinding> GetColApplied() {
-    return column_bindings_applied_;
-  }
+  int log_num_blocks() const { return log_num_blocks_; }
 
-  vector<ColumnBinding> GetColBuilt() {
-    return column_bindings_built_;
-  }
+  // The layout in use, resolved by CreateEmpty
+  BloomFilterLayout layout() const { return layout_; }
 
-  int log_num_blocks() const { return log_num_blocks_; }
+  // The requested layout; AUTO lets CreateEmpty pick the one that reaches
+  // the target false positive rate with the cheaper probe
+  void SetLayout(BloomFilterLayout layout) { requested_layout_ = layout; }
+
+  // Expected false positive rate of a layout holding bits_per_key bits per
+  // distinct key, the number of keys per block being Poisson distributed
+  static double ExpectedFalsePositiveRate(BloomFilterLayout layout, double bits_per_key);
 
   bool use_64bit_hashes() const { return use_64bit_hashes_; }
 
   int NumHashBitsUsed() const;
 
   bool IsSameAs(const BlockedBloomFilter* other) const;
+
+  // Number of 64-bit words of the filter
+  int64_t num_words() const { return num_blocks_ << (kLogBlockBitsOf(layout_) - 6); }
   
-  bool isEmpty() {
-    return blocks_ == nullptr;
+  bool isEmpty() override {
+    if (HasExactKeys()) {
+      return ExactKeys().isEmpty();
+    }
+    return empty_ || blocks_ == nullptr;
   }
+
+  // Set by the build side, which knows whether any key was inserted; the
+  // filter itself always has its minimum number of blocks allocated
+  void SetEmpty(bool empty) { empty_ = empty; }
   
   int64_t NumBitsSet() const;
 
@@ -175,17 +241,43 @@ public:
   //
   void Fold();
 
-  bool isUsed() {
-    return Used_;
-  }
-  
-  void setUsed() {
-    Used_ = true;
-  }
-
   // Num bits used per hash value
   static constexpr int64_t kMinNumBitsPerKey = 8;
   // static constexpr int64_t kMinNumBitsPerKey = 16;
+
+  // Bounds of the bits per key chosen by NumBitsToAllocate(). The lower
+  // bound only applies when the filter is shrunk to fit the last level cache.
+  static constexpr int64_t kMinNumBitsPerKeyInCache = 4;
+  static constexpr int64_t kMaxNumBitsPerKey = 16;
+
+  static constexpr double kDefaultFalsePositiveRate = 0.02;
+
+  // Rows between prefetching a block and probing it; covers a few hundred
+  // cycles of memory latency at the probe rate of the SIMD kernels.
+  static constexpr int64_t kDefaultPrefetchDistance = 32;
+
+  double false_positive_rate() const { return false_positive_rate_; }
+
+  void SetFalsePositiveRate(double false_positive_rate) {
+    false_positive_rate_ = false_positive_rate;
+  }
+
+  int64_t prefetch_distance() const { return prefetch_distance_; }
+
+  // 0 disables prefetching
+  void SetPrefetchDistance(int64_t prefetch_distance) {
+    prefetch_distance_ = prefetch_distance;
+  }
+
+  // Number of bits (a power of 2) for a filter holding num_keys distinct keys.
+  //
+  // The bits per key follow from the target false positive rate. A filter
+  // that would not fit the last level cache is shrunk, since nearly every
+  // probe of it would be a cache miss. A filter that fits L2 is grown when
+  // more rows will probe it than keys are inserted, because the extra
+  // precision is almost free to probe there.
+  //
+  int64_t NumBitsToAllocate(int64_t num_keys) const;
   
   // Maximum number of actually used blocks for 32-bit hashes, given num bits used to get mask.
   // When we want to use more blocks, 64-bit hashes are required.
@@ -194,74 +286,90 @@ public:
   static constexpr int64_t kNumBitsBlocksUsedBy32Bit = 32 - (BloomFilterMasks::kLogNumMasks + 6);
   static constexpr int64_t kNumBlocksUsedBy32Bit = 1 << kNumBitsBlocksUsedBy32Bit;
   static constexpr int64_t kMaxNumRowsFor32Bit = kNumBlocksUsedBy32Bit * 64 / kMinNumBitsPerKey;
-  
-  // The columns applied this BF
-  vector<ColumnBinding> column_bindings_applied_;
-  
-  // The columns build this BF
-  vector<ColumnBinding> column_bindings_built_;
-
-  vector<idx_t> BoundColsApplied;
 
-  vector<idx_t> BoundColsBuilt;
-  
   arrow::Status CreateEmpty(int64_t num_rows_to_insert, arrow::MemoryPool* pool);
 
   void Insert(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes);
 
 private:
-  inline void Insert(uint64_t hash) {
-    uint64_t m = mask(hash);
-    // uint64_t &b = blocks_[block_id(hash)];
-    // b |= m;
-    std::atomic<uint64_t> &b = blocks_[block_id(hash)];
-    b.fetch_or(m);
+  static constexpr int kLogBlockBitsOf(BloomFilterLayout layout) {
+    return layout == BloomFilterLayout::SECTORIZED ? SectorizedLayout::kLogBlockBits
+                                                   : RegisterBlockedLayout::kLogBlockBits;
   }
 
-  inline uint64_t mask(uint64_t hash) const {
-    // The lowest bits of hash are used to pick mask index.
-    //
-    int mask_id = static_cast<int>(hash & (BloomFilterMasks::kNumMasks - 1));
-    uint64_t result = masks_.mask(mask_id);
+  BloomFilterLayout ChooseLayout(int64_t num_bits, int64_t num_keys) const;
 
-    // The next set of hash bits is used to pick the amount of bit
-    // rotation of the mask.
+  // Builders guarantee that a block is only written by one thread at a time
+  // (the parallel builder holds the lock of the partition owning the block),
+  // so a plain read-modify-write is enough. A locked fetch_or would serialize
+  // on the cache line for every inserted key.
+  inline void SetBlockBits(int64_t word, uint64_t m) {
+    std::atomic<uint64_t> &b = blocks_[word];
+    b.store(b.load(std::memory_order_relaxed) | m, std::memory_order_relaxed);
+  }
+
+  inline int64_t block_id(uint64_t hash) const {
+    // The hash bits following the bits used to select a mask of the
+    // register blocked layout pick the block.
     //
-    int rotation = (hash >> BloomFilterMasks::kLogNumMasks) & 63;
-    result = ROTL64(result, rotation);
+    return (hash >> kBlockIdBitOffset) & (num_blocks_ - 1);
+  }
 
+  template <class LAYOUT>
+  inline bool FindHash(uint64_t hash) const {
+    const int64_t first_word = block_id(hash) * LAYOUT::kWordsPerBlock;
+    bool result = true;
+    for (int w = 0; w < LAYOUT::kWordsPerBlock; ++w) {
+      uint64_t m = LAYOUT::Mask(masks_, hash, w);
+      result &= (blocks_[first_word + w].load(std::memory_order_relaxed) & m) == m;
+    }
     return result;
   }
 
-  inline int64_t block_id(uint64_t hash) const {
-    // The next set of hash bits following the bits used to select a
-    // mask is used to pick block id (index of 64-bit word in a bit
-    // vector).
-    //
-    return (hash >> (BloomFilterMasks::kLogNumMasks + 6)) & (num_blocks_ - 1);
+  template <class LAYOUT>
+  inline void InsertHash(uint64_t hash) {
+    const int64_t first_word = block_id(hash) * LAYOUT::kWordsPerBlock;
+    for (int w = 0; w < LAYOUT::kWordsPerBlock; ++w) {
+      SetBlockBits(first_word + w, LAYOUT::Mask(masks_, hash, w));
+    }
   }
 
-  template <typename T>
-  inline void InsertImp(int64_t num_rows, const T* hashes);
+  template <class LAYOUT>
+  void InsertLayout(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes);
+
+  template <class LAYOUT>
+  void FindLayout(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes, SelectionVector &sel,
+                  idx_t &result_count, bool enable_prefetch) const;
+
+  template <class LAYOUT>
+  inline void InsertImp(int64_t num_rows, const uint64_t* hashes);
 
+  template <class LAYOUT>
   inline void FindImp(int64_t num_rows, int64_t num_preprocessed, const uint64_t* hashes, SelectionVector &sel,
-                      idx_t &result_count, bool enable_prefetch) const;
+                      idx_t &result_count, int64_t prefetch_distance) const;
 
   void SingleFold(int num_folds);
 
+  // The SIMD kernels, specialized per layout in bloom_filter_avx2.cpp. They
+  // process a multiple of 8 rows (the probe kernels append the matching rows
+  // to sel) and return how many; the rest is left to InsertImp / FindImp.
+  template <class LAYOUT>
+  int64_t Insert_avx2(int64_t num_rows, const uint64_t* hashes);
+  template <class LAYOUT>
+  int64_t Find_avx2(int64_t num_rows, const uint64_t* hashes, int64_t prefetch_distance,
+                    SelectionVector &sel, idx_t &result_count) const;
+
   inline __m256i mask_avx2(__m256i hash) const;
   inline __m256i block_id_avx2(__m256i hash) const;
-  int64_t Insert_avx2(int64_t num_rows, const uint32_t* hashes);
-  int64_t Insert_avx2(int64_t num_rows, const uint64_t* hashes);
-  template <typename T>
-  int64_t InsertImp_avx2(int64_t num_rows, const T* hashes);
-  int64_t Find_avx2(int64_t num_rows, const uint64_t* hashes,
-                    uint8_t* result_bit_vector) const;
-  int64_t FindImp_avx2(int64_t num_rows, const uint64_t* hashes,
-                       uint8_t* result_bit_vector) const;
+#ifdef __AVX512F__
+  inline __m512i mask_avx512(__m512i hash) const;
+  inline __m512i block_id_avx512(__m512i hash) const;
+  int64_t Find_avx512(int64_t num_rows, const uint64_t* hashes, int64_t prefetch_distance,
+                      SelectionVector &sel, idx_t &result_count) const;
+#endif
 
   bool UsePrefetch() const {
-    return num_blocks_ * sizeof(uint64_t) > kPrefetchLimitBytes;
+    return num_words() * static_cast<int64_t>(sizeof(uint64_t)) > kPrefetchLimitBytes;
   }
 
   void SetBuf(const std::shared_ptr<arrow::Buffer> &buf) {
@@ -284,19 +392,40 @@ private:
   int log_num_blocks_;
   int64_t num_blocks_;
 
+  BloomFilterLayout requested_layout_ = BloomFilterLayout::AUTO;
+  BloomFilterLayout layout_ = BloomFilterLayout::REGISTER_BLOCKED;
+
   // Whether to use 64-bit hashes as input values.
   bool use_64bit_hashes_;
 
+  double false_positive_rate_ = kDefaultFalsePositiveRate;
+
+  int64_t prefetch_distance_ = kDefaultPrefetchDistance;
+
+  // No key was inserted
+  bool empty_ = false;
+
   // Buffer allocated to store an array of power of 2 64-bit blocks.
   std::shared_ptr<arrow::Buffer> buf_;
   
   // Pointer to mutable data owned by Buffer
   // uint64_t* blocks_ = nullptr;
   std::atomic<uint64_t>* blocks_;
-
-  bool Used_;
 };
 
+template <>
+int64_t BlockedBloomFilter::Insert_avx2<RegisterBlockedLayout>(int64_t num_rows, const uint64_t* hashes);
+template <>
+int64_t BlockedBloomFilter::Insert_avx2<SectorizedLayout>(int64_t num_rows, const uint64_t* hashes);
+template <>
+int64_t BlockedBloomFilter::Find_avx2<RegisterBlockedLayout>(int64_t num_rows, const uint64_t* hashes,
+                                                             int64_t prefetch_distance, SelectionVector &sel,
+                                                             idx_t &result_count) const;
+template <>
+int64_t BlockedBloomFilter::Find_avx2<SectorizedLayout>(int64_t num_rows, const uint64_t* hashes,
+                                                        int64_t prefetch_distance, SelectionVector &sel,
+                                                        idx_t &result_count) const;
+
 // We have two separate implementations of building a Bloom filter, multi-threaded and
 // single-threaded.
 //
@@ -322,7 +451,7 @@ public:
   virtual arrow::Status PushNextBatch(size_t thread_index, int64_t num_rows,
                                const uint64_t* hashes) = 0;
 
-  virtual vector<idx_t> BuiltCols() = 0;
+  virtual const vector<idx_t> &BuiltCols() const = 0;
 
   virtual void CleanUp() {}
 
@@ -338,7 +467,7 @@ public:
   arrow::Status PushNextBatch(size_t /*thread_index*/, int64_t num_rows,
                        const uint64_t* hashes) override;
 
-  vector<idx_t> BuiltCols() override;
+  const vector<idx_t> &BuiltCols() const override;
 
 private:
   void PushNextBatchImp(int64_t num_rows, const uint64_t* hashes);
@@ -360,7 +489,11 @@ class ARROW_ACERO_EXPORT BloomFilterBuilder_Parallel : public BloomFilterBuilder
 
     void Merge() override;
 
-    vector<idx_t> BuiltCols() override;
+    const vector<idx_t> &BuiltCols() const override;
+
+    // Partitions per thread (as a power of 2): more partitions than threads
+    // make it less likely that two threads wait for the same partition lock.
+    static constexpr int kLogNumPrtnsPerThread = 2;
   
   private:
     void PushNextBatchImp(size_t thread_id, int64_t num_rows, const uint64_t* hashes);
@@ -374,7 +507,6 @@ class ARROW_ACERO_EXPORT BloomFilterBuilder_Parallel : public BloomFilterBuilder
     std::vector<uint64_t> partitioned_hashes_64;
     std::vector<uint16_t> partition_ranges;
     std::vector<int> unprocessed_partition_ids;
-    shared_ptr<BlockedBloomFilter> local_bf;
   };
   std::vector<ThreadLocalState> thread_local_states_;
   PartitionLocks prtn_locks_;
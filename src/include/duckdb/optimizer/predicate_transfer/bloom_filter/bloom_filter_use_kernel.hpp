@@ -10,12 +10,15 @@ namespace duckdb {
 class BloomFilterUseKernel {
 
 public:
-  // use vanilla bloom filter (reuse column indices made by the caller)
+  // probe hashes computed once by the caller; only the first `count` rows of `sel`
+  // (all rows if `sel` is null) are tested, survivors are written to `result_sel`,
+  // which may alias `sel`
   static void
-  filter(const vector<Vector> &result,
-         shared_ptr<BlockedBloomFilter> bloom_filter,
-         SelectionVector &sel,
-         idx_t &approved_tuple_count,
-         idx_t row_num);
+  filter(const hash_t *hashes,
+         BlockedBloomFilter &bloom_filter,
+         const SelectionVector *sel,
+         idx_t count,
+         SelectionVector &result_sel,
+         idx_t &approved_tuple_count);
 };
 }
\ No newline at end of file
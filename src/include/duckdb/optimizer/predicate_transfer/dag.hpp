@@ -18,19 +18,11 @@ public:
 
     void AddIn(idx_t from, Expression* filter,  bool forward);
 
-#ifdef UseHashFilter
-    void AddIn(idx_t from, shared_ptr<HashFilter> bloom_filter, bool forward);
-#else
-    void AddIn(idx_t from, shared_ptr<BlockedBloomFilter> bloom_filter, bool forward);
-#endif
+    void AddIn(idx_t from, shared_ptr<TransferFilter> bloom_filter, bool forward);
 
     void AddOut(idx_t to, Expression* filter, bool forward);
 
-#ifdef UseHashFilter
-    void AddOut(idx_t to, shared_ptr<HashFilter> bloom_filter, bool forward);
-#else
-    void AddOut(idx_t to, shared_ptr<BlockedBloomFilter> bloom_filter, bool forward);
-#endif
+    void AddOut(idx_t to, shared_ptr<TransferFilter> bloom_filter, bool forward);
 
     vector<unique_ptr<DAGEdge>> forward_in_;
     vector<unique_ptr<DAGEdge>> backward_in_;
@@ -56,11 +48,7 @@ public:
         filters.emplace_back(filter);
     }
 
-#ifdef UseHashFilter
-    void Push(shared_ptr<HashFilter> bloom_filter) {
-#else
-    void Push(shared_ptr<BlockedBloomFilter> bloom_filter) {
-#endif
+    void Push(shared_ptr<TransferFilter> bloom_filter) {
         bloom_filters.emplace_back(bloom_filter);
     }
     
@@ -70,11 +58,7 @@ public:
 
     vector<Expression*> filters;
     
-#ifdef UseHashFilter
-    vector<shared_ptr<HashFilter>> bloom_filters;
-#else
-    vector<shared_ptr<BlockedBloomFilter>> bloom_filters;
-#endif
+    vector<shared_ptr<TransferFilter>> bloom_filters;
 
     idx_t dest_;
 };
@@ -36,11 +36,7 @@ public:
 
     vector<LogicalOperator*>& getExecOrder();
 
-#ifdef UseHashFilter
-    void Add(idx_t create_table, shared_ptr<HashFilter> use_bf, bool reverse);
-#else
-    void Add(idx_t create_table, shared_ptr<BlockedBloomFilter> use_bf, bool reverse);
-#endif
+    void Add(idx_t create_table, shared_ptr<TransferFilter> use_bf, bool reverse);
 
     NodesManager nodes_manager;
 
@@ -73,8 +69,14 @@ private:
     void ExtractEdges(LogicalOperator &op,
                       vector<reference<LogicalOperator>> &filter_operators);
     
+    int CreateRootedVertices(vector<LogicalOperator*> &sorted_nodes, unordered_set<int> &constructed_set,
+                             unordered_set<int> &unconstructed_set);
+    void AttachNode(pair<int, int> &selected_edge, int &prior_flag, unordered_set<int> &constructed_set,
+                    unordered_set<int> &unconstructed_set);
+
     void LargestRoot(vector<LogicalOperator*> &sorted_nodes);
     void Small2Large(vector<LogicalOperator*> &sorted_nodes);
+    void BushyRoot(vector<LogicalOperator*> &sorted_nodes);
     void RandomRoot(vector<LogicalOperator*> &sorted_nodes);
 
     void CreateDAG();
@@ -83,6 +85,10 @@ private:
 
     pair<int, int> FindEdgeRandom(unordered_set<int> &constructed_set, unordered_set<int> &unconstructed_set, std::uniform_int_distribution<idx_t> &dist);
 
+    bool GetExpressionTable(Expression &expr, idx_t &table);
+
+    bool CrossesWindow(idx_t join_index, Expression &expr);
+
     vector<DAGNode*> GetNeighbors(idx_t node_id);
 
     void AddEdge(DAGNode &node, vector<DAGEdgeInfo*> &neighbors);
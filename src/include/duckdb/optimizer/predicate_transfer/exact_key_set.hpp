@@ -0,0 +1,81 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+class Vector;
+
+// Exact membership of the build keys of a single integer column.
+//
+// CreateBF picks it over the configured filter once the key statistics of
+// the build side are known: a bitmap over [min, max] when the keys are
+// dense, a sorted array when there are only a few of them. Both stay in the
+// CPU caches, probe the keys without hashing them and have no false
+// positives.
+//
+class ExactKeySet {
+public:
+  enum class Kind : uint8_t { BITMAP, SORTED_ARRAY };
+
+  // Largest bitmap in bits (1 MiB, about the size of L2)
+  static constexpr const idx_t kMaxBitmapBits = idx_t(1) << 23;
+  // Bits per distinct key a bitmap may spend, the most a Bloom filter does
+  static constexpr const idx_t kMaxBitmapBitsPerKey = 16;
+  // Largest sorted array, a binary search over it touches a few cache lines
+  static constexpr const idx_t kMaxSortedKeys = 1024;
+
+  // Whether keys of this type can be held, i.e. are integers that fit an int64_t
+  static bool SupportsType(const LogicalType &type);
+
+  // The set for keys in [min, max] with about num_distinct distinct values,
+  // nullptr if it would not be small enough
+  static unique_ptr<ExactKeySet> Choose(int64_t min, int64_t max, idx_t num_distinct);
+
+  Kind GetKind() const {
+    return kind_;
+  }
+
+  // Add the non-NULL keys of one chunk; several threads may insert at once
+  void Insert(Vector &keys, idx_t count);
+
+  // Called once all keys are inserted
+  void Finalize();
+
+  bool isEmpty() const {
+    return empty_;
+  }
+
+  // Keep the rows of `sel` (all rows if nullptr) whose key is in the set;
+  // `result` may alias `sel`
+  void Select(Vector &keys, const SelectionVector *sel, idx_t count,
+              SelectionVector &result, idx_t &result_count) const;
+
+private:
+  ExactKeySet(Kind kind, int64_t min, idx_t range);
+
+  template <class T>
+  void TemplatedInsert(Vector &keys, idx_t count);
+
+  template <class T>
+  void TemplatedSelect(Vector &keys, const SelectionVector *sel, idx_t count,
+                       SelectionVector &result, idx_t &result_count) const;
+
+  inline bool Contains(int64_t key) const;
+
+  Kind kind_;
+  int64_t min_;
+  idx_t range_;
+
+  // BITMAP: bit i is set if min + i is a key
+  unsafe_unique_array<atomic<uint64_t>> bits_;
+
+  // SORTED_ARRAY: the distinct keys in ascending order
+  vector<int64_t> keys_;
+  mutex keys_lock_;
+
+  bool empty_ = true;
+};
+}
@@ -15,63 +15,36 @@
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/optimizer/predicate_transfer/hash_filter/hashtable.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_filter.hpp"
 
-// #define UseHashFilter
-
-#ifdef UseHashFilter
 namespace duckdb {
 class BufferManager;
 
 // A Hash filter implementation.
-class HashFilter {
+class HashFilter : public TransferFilter {
   friend class HashFilterBuilder_SingleThreaded;
   friend class HashFilterBuilder_Parallel;
 
 public:
   HashFilter()
-    : Used_(false) {}
+    : TransferFilter(TransferFilterType::HASH_FILTER) {}
   HashFilter(int log_num_blocks, bool use_64bit_hashes)
-    : Used_(false) {}
-
-  void AddColumnBindingApplied(ColumnBinding column_binding) {
-    column_bindings_applied_.emplace_back(column_binding);
-  }
-
-  void AddColumnBindingBuilt(ColumnBinding column_binding) {
-    column_bindings_built_.emplace_back(column_binding);
-  }
+    : TransferFilter(TransferFilterType::HASH_FILTER) {}
 
   void Find(int64_t hardware_flags, int64_t num_rows, DataChunk& values,
             SelectionVector &sel, idx_t &result_count, bool enable_prefetch = true) const;
 
-  vector<ColumnBinding> GetColApplied() {
-    return column_bindings_applied_;
-  }
-
-  vector<ColumnBinding> GetColBuilt() {
-    return column_bindings_built_;
-  }
-
-  bool isEmpty() {
+  bool isEmpty() override {
+    if (HasExactKeys()) {
+      return ExactKeys().isEmpty();
+    }
     return hash_table->Count() == 0;
   }
-  
-  bool isUsed() {
-    return Used_;
-  }
-  
-  void setUsed() {
-    Used_ = true;
-  }
-  
+
   arrow::Status CreateEmpty(BufferManager* buffer, vector<LogicalType> layouts);
 
   void Insert(int64_t hardware_flags, int64_t num_rows, int32_t* value);
 
-  vector<idx_t> BoundColsApplied;
-
-  vector<idx_t> BoundColsBuilt;
-  
   // the key component of hash filter
   std::shared_ptr<HashTable> hash_table;
 
@@ -88,17 +61,9 @@ private:
           return lhs == rhs;     
       }
   };
- 
-  // The columns applied this Hash Filter
-  vector<ColumnBinding> column_bindings_applied_;
-  
-  // The columns build this Hash Filter
-  vector<ColumnBinding> column_bindings_built_;
 
   // Buffer allocated to store an array of power of 2 64-bit blocks.
   std::shared_ptr<arrow::Buffer> buf_;
-  
-  bool Used_;
 };
 
 // We have two separate implementations of building a Hash filter, multi-threaded and
@@ -118,7 +83,7 @@ public:
   virtual int64_t num_tasks() const { return 0; }
   virtual arrow::Status PushNextBatch(size_t thread_index, int64_t num_rows, DataChunk& values) = 0;
 
-  virtual vector<idx_t> BuiltCols() = 0;
+  virtual const vector<idx_t> &BuiltCols() const = 0;
 
   virtual void CleanUp() {}
   virtual void Print() = 0;
@@ -135,7 +100,7 @@ public:
 
   arrow::Status PushNextBatch(size_t /*thread_index*/, int64_t num_rows, DataChunk& values) override;
 
-  vector<idx_t> BuiltCols() override;
+  const vector<idx_t> &BuiltCols() const override;
   void Print();
 
 private:
@@ -155,7 +120,7 @@ class ARROW_ACERO_EXPORT HashFilterBuilder_Parallel : public HashFilterBuilder {
 
     void Merge() override;
 
-    vector<idx_t> BuiltCols() override;
+    const vector<idx_t> &BuiltCols() const override;
     void Print();
   private:
     void PushNextBatchImp(size_t thread_id, int64_t num_rows, int32_t* values);
@@ -166,4 +131,3 @@ class ARROW_ACERO_EXPORT HashFilterBuilder_Parallel : public HashFilterBuilder {
   int log_num_prtns_;
 };
 }
-#endif
\ No newline at end of file
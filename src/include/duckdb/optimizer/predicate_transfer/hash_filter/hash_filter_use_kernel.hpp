@@ -3,7 +3,6 @@
 #include "duckdb/optimizer/predicate_transfer/hash_filter/hash_filter.hpp"
 #include "duckdb/common/types/vector.hpp"
 
-#ifdef UseHashFilter
 namespace duckdb {
 /**
  * Caller needs to check if table is empty and bloom filter is valid
@@ -11,13 +10,23 @@ namespace duckdb {
 class HashFilterUseKernel {
 
 public:
-  // use hash filter (reuse column indices made by the caller)
+  // only the first `count` rows of `sel` (all rows if `sel` is null) are probed,
+  // survivors are written to `result_sel`, which may alias `sel`
   static void
   filter(vector<Vector> &input,
-         shared_ptr<HashFilter> bloom_filter,
-         SelectionVector &sel,
-         idx_t &approved_tuple_count,
-         idx_t row_num);
+         HashFilter &hash_filter,
+         const SelectionVector *sel,
+         idx_t count,
+         SelectionVector &result_sel,
+         idx_t &approved_tuple_count);
+
+  // same as above, on the key columns only (in the order of BoundColsApplied)
+  static void
+  filter(DataChunk &keys,
+         HashFilter &hash_filter,
+         const SelectionVector *sel,
+         idx_t count,
+         SelectionVector &result_sel,
+         idx_t &approved_tuple_count);
 };
-}
-#endif
\ No newline at end of file
+}
\ No newline at end of file
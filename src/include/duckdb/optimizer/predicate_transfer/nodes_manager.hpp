@@ -1,6 +1,7 @@
 #pragma once
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/joinside.hpp"
 
 namespace duckdb {
 class NodesManager {
@@ -53,6 +54,9 @@ public:
 
 	ColumnBinding FindRename(ColumnBinding col);
 
+	//! Whether the join at `join_index` of the extracted joins sits above a window that `col` may not pass
+	bool CrossesWindow(idx_t join_index, ColumnBinding col);
+
 private:
 	ClientContext &context;
 
@@ -78,7 +82,14 @@ private:
 
 	unordered_map<ColumnBinding, ColumnBinding, HashFunc, CmpFunc> rename_cols;
 
+	//! The input columns of windows that are not a partition column of all their functions, each with the number
+	//! of joins extracted before the window was reached: the joins above it
+	unordered_map<ColumnBinding, idx_t, HashFunc, CmpFunc> window_barriers;
+
 public:
 	static idx_t GetTableIndexinFilter(LogicalOperator *op);
+
+	//! Whether a join condition can be transferred: equalities, and inequalities of inner joins
+	static bool IsTransferCondition(JoinType join_type, const JoinCondition &cond);
 };
 }
\ No newline at end of file
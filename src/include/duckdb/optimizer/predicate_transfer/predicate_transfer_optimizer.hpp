@@ -1,12 +1,13 @@
 #pragma once
 
 #include "duckdb/optimizer/predicate_transfer/dag_manager.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_cost_model.hpp"
 #include "duckdb/planner/operator/logical_create_bf.hpp"
 
 namespace duckdb {
 class PredicateTransferOptimizer {
 public:
-    explicit PredicateTransferOptimizer(ClientContext &context) : context(context), dag_manager(context) {
+    explicit PredicateTransferOptimizer(ClientContext &context) : context(context), dag_manager(context), cost_model(context, dag_manager.nodes_manager) {
 	}
 
     unique_ptr<LogicalOperator> PreOptimize(unique_ptr<LogicalOperator> plan, optional_ptr<RelationStats> stats = nullptr);
@@ -22,6 +23,8 @@ private:
 
     DAGManager dag_manager;
 
+    TransferCostModel cost_model;
+
     std::unordered_map<void*, unique_ptr<LogicalOperator>> replace_map_forward;
 
     std::unordered_map<void*, unique_ptr<LogicalOperator>> replace_map_backward;
@@ -31,36 +34,32 @@ private:
 private:
     void GetColumnBindingExpression(Expression &expr, vector<BoundColumnRefExpression*> &expressions);
 
-#ifdef UseHashFilter
-    vector<pair<idx_t, shared_ptr<HashFilter>>> CreateBloomFilter(LogicalOperator &node, bool reverse);
-
-    void GetAllBFUsed(idx_t cur, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
+    vector<pair<idx_t, shared_ptr<TransferFilter>>> CreateBloomFilter(LogicalOperator &node, bool reverse);
 
-    void GetAllBFCreate(idx_t cur, vector<shared_ptr<HashFilter>> &temp_result_to_create, bool reverse);
+    void GetAllBFUsed(idx_t cur, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
 
-    unique_ptr<LogicalCreateBF> BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_create);
+    shared_ptr<TransferFilter> MakeTransferFilter();
 
-    unique_ptr<LogicalUseBF> BuildUseOperator(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
+    idx_t GetKeyTable(Expression &key);
 
-    unique_ptr<LogicalCreateBF> BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<shared_ptr<HashFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse);
-#else
-    vector<pair<idx_t, shared_ptr<BlockedBloomFilter>>> CreateBloomFilter(LogicalOperator &node, bool reverse);
+    unique_ptr<Expression> RenameKey(Expression &key);
 
-    void GetAllBFUsed(idx_t cur, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
+    void AddFilterKeys(TransferFilter &filter, vector<unique_ptr<Expression>> &keys_built, vector<unique_ptr<Expression>> &keys_applied);
 
-    void GetAllBFCreate(idx_t cur, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create, bool reverse);
+    void GetAllBFCreate(idx_t cur, vector<shared_ptr<TransferFilter>> &temp_result_to_create, bool reverse);
 
-    unique_ptr<LogicalCreateBF> BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create);
+    unique_ptr<LogicalCreateBF> BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_create);
 
-    unique_ptr<LogicalUseBF> BuildUseOperator(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
+    unique_ptr<LogicalUseBF> BuildUseOperator(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse);
 
-    unique_ptr<LogicalCreateBF> BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse);
-#endif
+    unique_ptr<LogicalCreateBF> BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<shared_ptr<TransferFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse);
 
     idx_t GetNodeId(LogicalOperator &node);
-    
-    bool PossibleFilterAny(LogicalOperator &node, bool reverse);
 
+    unique_ptr<LogicalOperator> AttachBelowChain(unique_ptr<LogicalOperator> chain, unique_ptr<LogicalOperator> plan);
+
+    void PushUseIntoBranches(LogicalUseBF &use_bf, LogicalOperator &set_operation);
+    
     unique_ptr<LogicalOperator> InsertCreateTable(unique_ptr<LogicalOperator> plan, LogicalOperator* plan_ptr);
 };
 }
\ No newline at end of file
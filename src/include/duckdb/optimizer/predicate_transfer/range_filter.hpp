@@ -0,0 +1,54 @@
+#pragma once
+
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_filter.hpp"
+
+namespace duckdb {
+class Vector;
+
+// The filter shipped along an inequality join condition.
+//
+// For `probe.x >= build.y` a probe row can only find a join partner if x is
+// at least the smallest y, so the build side only ships that bound: the key
+// range CreateBF collects anyway. The scans of the probe side use it like a
+// constant comparison, on their zonemaps and on the rows.
+//
+class RangeFilter : public TransferFilter {
+public:
+  // `comparison` is how an applied key compares to the build keys
+  explicit RangeFilter(ExpressionType comparison)
+    : TransferFilter(TransferFilterType::RANGE_FILTER), comparison_(comparison) {}
+
+  bool isEmpty() override {
+    return empty_;
+  }
+
+  void SetEmpty(bool empty) {
+    empty_ = empty;
+  }
+
+  ExpressionType GetComparison() const {
+    return comparison_;
+  }
+
+  // The build key the applied keys are compared with, NULL if it is unknown
+  const Value &Bound() const {
+    if (comparison_ == ExpressionType::COMPARE_GREATERTHAN ||
+        comparison_ == ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+      return KeyMin();
+    }
+    return KeyMax();
+  }
+
+  // Keep the rows of `sel` (all rows if nullptr) whose key satisfies the
+  // comparison with the bound; `result` may alias `sel`
+  void Select(Vector &keys, const SelectionVector *sel, idx_t count,
+              SelectionVector &result, idx_t &result_count) const;
+
+private:
+  ExpressionType comparison_;
+
+  bool empty_ = false;
+};
+}
@@ -1,12 +0,0 @@
-// Exclusive
-// #define BloomJoin
-#define PredicateTransfer
-
-// Exclusive
-// #define ExactLeftDeep
-// #define RandomBushy
-// #define RandomLeftDeep
-
-// #define SmalltoLarge
-
-// #define External
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "duckdb/optimizer/predicate_transfer/nodes_manager.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_filter.hpp"
+#include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
+
+namespace duckdb {
+
+//! Estimates what a transfer filter buys along one DAG edge.
+//!
+//! Every node starts from the RelationStats of its scan (cardinality after
+//! table filters and per-column distinct counts). A filter is expected to let
+//! through the fraction of probe keys covered by the build keys; nodes that
+//! apply filters shrink accordingly, so later edges, including the backward
+//! pass, see the reduced estimates.
+class TransferCostModel {
+public:
+	TransferCostModel(ClientContext &context, NodesManager &nodes_manager)
+	    : context(context), nodes_manager(nodes_manager) {
+	}
+
+	//! Estimate the filter built on build_node and applied to probe_node, and return whether
+	//! the rows it removes are worth building and probing it
+	bool IsBeneficial(idx_t build_node, idx_t probe_node, TransferFilter &filter);
+
+	//! Shrink the estimates of a node by the filters it applies
+	void ApplyFilters(idx_t node, const vector<shared_ptr<TransferFilter>> &filters);
+
+private:
+	struct NodeEstimate {
+		//! Whether the node has statistics; edges touching a node without any are always kept
+		bool known = false;
+		//! Rows of the relation before any filter
+		double base_cardinality = 1;
+		double cardinality = 1;
+		//! Estimated distinct values per column binding index, clamped by the cardinality on lookup
+		unordered_map<idx_t, double> distinct;
+	};
+
+	struct FilterEstimate {
+		double selectivity = 1;
+		//! Estimated distinct build keys per applied column
+		vector<double> build_distinct;
+	};
+
+	ClientContext &context;
+	NodesManager &nodes_manager;
+
+	unordered_map<idx_t, NodeEstimate> node_estimates;
+	unordered_map<TransferFilter *, FilterEstimate> filter_estimates;
+
+private:
+	NodeEstimate &GetEstimate(idx_t node);
+	double GetDistinct(idx_t node, const ColumnBinding &binding);
+};
+} // namespace duckdb
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/enums/predicate_transfer_mode.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "duckdb/planner/expression.hpp"
+#include "duckdb/optimizer/predicate_transfer/exact_key_set.hpp"
+
+namespace duckdb {
+
+// The filter shipped along one edge of the predicate transfer DAG.
+//
+// It records which columns build the filter and which columns it is applied
+// to; the membership structure itself is provided by the concrete filter
+// (BlockedBloomFilter or HashFilter), selected per query by
+// the predicate_transfer_filter setting.
+//
+class TransferFilter {
+public:
+  // Builds with at most this many rows also keep their exact key list
+  static constexpr const idx_t MAX_KEY_LIST_SIZE = 1024;
+
+  explicit TransferFilter(TransferFilterType filter_type)
+    : filter_type_(filter_type), Used_(false) {}
+  virtual ~TransferFilter() = default;
+
+  void AddColumnBindingApplied(ColumnBinding column_binding) {
+    column_bindings_applied_.emplace_back(column_binding);
+  }
+
+  void AddColumnBindingBuilt(ColumnBinding column_binding) {
+    column_bindings_built_.emplace_back(column_binding);
+  }
+
+  vector<ColumnBinding> GetColApplied() {
+    return column_bindings_applied_;
+  }
+
+  vector<ColumnBinding> GetColBuilt() {
+    return column_bindings_built_;
+  }
+
+  // A side whose keys are not all plain columns (e.g. `a.x + 1 = b.y`) has
+  // one expression per key; the operators evaluate them into extra columns
+  // appended to their input, and the bound columns point at those.
+  void AddExpressionBuilt(unique_ptr<Expression> expression) {
+    expressions_built_.emplace_back(std::move(expression));
+  }
+
+  void AddExpressionApplied(unique_ptr<Expression> expression) {
+    expressions_applied_.emplace_back(std::move(expression));
+  }
+
+  // Estimated number of rows the filter is applied to (0 if unknown)
+  void SetProbeCardinality(idx_t probe_cardinality) {
+    probe_cardinality_ = probe_cardinality;
+  }
+
+  idx_t GetProbeCardinality() const {
+    return probe_cardinality_;
+  }
+
+  TransferFilterType GetFilterType() const {
+    return filter_type_;
+  }
+
+  virtual bool isEmpty() = 0;
+
+  bool isUsed() {
+    return Used_;
+  }
+
+  void setUsed() {
+    Used_ = true;
+  }
+
+  // In pipelined transfer the consumers of a filter do not wait for its
+  // CreateBF pipeline; they let every row pass until the filter is published.
+  void SetPipelined() {
+    pipelined_ = true;
+    published_ = false;
+  }
+
+  void Publish() {
+    published_.store(true, std::memory_order_release);
+  }
+
+  // Whether the filter may be probed (always, unless it is pipelined)
+  bool IsReady() const {
+    return !pipelined_ || published_.load(std::memory_order_acquire);
+  }
+
+  // Consumers that keep no state of their own, i.e. table scans, count the
+  // rows they probe on the filter itself. Once `min_rows` rows were probed
+  // and more than `max_pass_rate` of them passed, the filter is switched off.
+  void RecordProbe(idx_t rows_in, idx_t rows_out, idx_t min_rows, double max_pass_rate) {
+    auto total_in = probed_rows_in_.fetch_add(rows_in, std::memory_order_relaxed) + rows_in;
+    auto total_out = probed_rows_out_.fetch_add(rows_out, std::memory_order_relaxed) + rows_out;
+    if (total_in >= min_rows && double(total_out) > max_pass_rate * double(total_in)) {
+      switched_off_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  bool IsSwitchedOff() const {
+    return switched_off_.load(std::memory_order_relaxed);
+  }
+
+  // Forget the probes of an earlier execution, whenever the filter is built
+  // again: its keys and pass rate may differ
+  void ResetProbeStats() {
+    probed_rows_in_.store(0, std::memory_order_relaxed);
+    probed_rows_out_.store(0, std::memory_order_relaxed);
+    switched_off_.store(false, std::memory_order_relaxed);
+  }
+
+  // Summary of the build keys of a single-column filter, filled in by
+  // CreateBF next to the filter itself. Scans compare it against their
+  // zonemaps to skip row groups and segments without hashing a single key.
+  void ResetKeySummary() {
+    key_min_ = Value();
+    key_max_ = Value();
+    key_list_.clear();
+    has_key_list_ = false;
+    exact_keys_.reset();
+  }
+
+  void SetKeyRange(Value min, Value max) {
+    key_min_ = std::move(min);
+    key_max_ = std::move(max);
+  }
+
+  bool HasKeyRange() const {
+    return !key_min_.IsNull() && !key_max_.IsNull();
+  }
+
+  const Value &KeyMin() const {
+    return key_min_;
+  }
+
+  const Value &KeyMax() const {
+    return key_max_;
+  }
+
+  void SetKeyList(vector<Value> key_list) {
+    key_list_ = std::move(key_list);
+    has_key_list_ = true;
+  }
+
+  bool HasKeyList() const {
+    return has_key_list_;
+  }
+
+  // The distinct non-NULL build keys, only set when HasKeyList()
+  const vector<Value> &KeyList() const {
+    return key_list_;
+  }
+
+  // Exact membership of the build keys, chosen by CreateBF over the filter
+  // itself when the keys turn out to be few or dense. When set, the filter
+  // is not built and the consumers probe the key set instead.
+  void SetExactKeys(unique_ptr<ExactKeySet> exact_keys) {
+    exact_keys_ = std::move(exact_keys);
+  }
+
+  bool HasExactKeys() const {
+    return exact_keys_ != nullptr;
+  }
+
+  ExactKeySet &ExactKeys() {
+    return *exact_keys_;
+  }
+
+  template <class TARGET>
+  TARGET &Cast() {
+    D_ASSERT(dynamic_cast<TARGET *>(this));
+    return reinterpret_cast<TARGET &>(*this);
+  }
+
+  // The columns applied this filter
+  vector<ColumnBinding> column_bindings_applied_;
+
+  // The columns build this filter
+  vector<ColumnBinding> column_bindings_built_;
+
+  vector<idx_t> BoundColsApplied;
+
+  vector<idx_t> BoundColsBuilt;
+
+  // The key expressions, empty if the keys are plain columns
+  vector<unique_ptr<Expression>> expressions_applied_;
+
+  vector<unique_ptr<Expression>> expressions_built_;
+
+protected:
+  TransferFilterType filter_type_;
+
+  bool Used_;
+
+  bool pipelined_ = false;
+  atomic<bool> published_ {false};
+
+  idx_t probe_cardinality_ = 0;
+
+  atomic<idx_t> probed_rows_in_ {0};
+  atomic<idx_t> probed_rows_out_ {0};
+  atomic<bool> switched_off_ {false};
+
+  Value key_min_;
+  Value key_max_;
+  vector<Value> key_list_;
+  bool has_key_list_ = false;
+
+  unique_ptr<ExactKeySet> exact_keys_;
+};
+}
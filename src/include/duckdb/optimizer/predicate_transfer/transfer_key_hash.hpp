@@ -0,0 +1,33 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+class Vector;
+
+// Hashes the key columns of a Bloom filter.
+//
+// The hashes equal VectorOperations::Hash of the first column combined by
+// VectorOperations::CombineHash with the others, so a hash join can reuse
+// them. Keys of one or two INTEGER/BIGINT columns, the common join keys,
+// are hashed by a fused loop that reads the columns in place and writes
+// every hash once; other keys take the generic vector operations.
+//
+class TransferKeyHash {
+public:
+  // Hash the rows of `sel` (the first `count` rows if nullptr) of the
+  // columns `cols` of `columns`; the hash of row r is written to position r
+  // of `hashes`, which is left a flat vector and may wrap a caller's buffer.
+  static void Hash(vector<Vector> &columns, const vector<idx_t> &cols, const SelectionVector *sel,
+                   idx_t count, Vector &hashes);
+  // The same for a key of a single column
+  static void Hash(Vector &keys, const SelectionVector *sel, idx_t count, Vector &hashes);
+
+private:
+  // Hash one or two (if `second` is set) integer columns, false if the types have no fused loop
+  static bool HashFused(Vector &first, Vector *second, const SelectionVector *sel, idx_t count, Vector &hashes);
+  // Turn the constant hashes of constant keys into flat ones
+  static void Flatten(const SelectionVector *sel, idx_t count, Vector &hashes);
+};
+}
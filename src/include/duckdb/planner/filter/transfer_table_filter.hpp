@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/transfer_table_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_filter.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+
+//! A predicate transfer filter (Bloom or hash filter) on a single key column, evaluated inside the table scan so
+//! that the other columns are only fetched for rows that pass it
+class TransferTableFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::TRANSFER_FILTER;
+
+public:
+	explicit TransferTableFilter(shared_ptr<TransferFilter> filter);
+
+	//! The filter, built by a CreateBF operator before the scan runs
+	shared_ptr<TransferFilter> filter;
+
+public:
+	//! Keep only the rows of `sel` whose key is (possibly) contained in the filter
+	void Filter(Vector &keys, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	unique_ptr<TableFilter> Copy() override;
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+};
+
+} // namespace duckdb
@@ -14,17 +14,9 @@ public:
 	PhysicalCreateBF *physical = nullptr;
 
 public:
-#ifdef UseHashFilter
-	LogicalCreateBF(vector<shared_ptr<HashFilter>> temp_result);
-#else
-	LogicalCreateBF(vector<shared_ptr<BlockedBloomFilter>> temp_result);
-#endif
-
-#ifdef UseHashFilter
-	vector<shared_ptr<HashFilter>> bf_to_create;
-#else  
-	vector<shared_ptr<BlockedBloomFilter>> bf_to_create;
-#endif
+	LogicalCreateBF(vector<shared_ptr<TransferFilter>> temp_result);
+
+	vector<shared_ptr<TransferFilter>> bf_to_create;
 
 public:
 	string ParamsToString() const override;
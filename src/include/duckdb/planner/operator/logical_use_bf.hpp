@@ -11,20 +11,16 @@ public:
 	static constexpr const LogicalOperatorType TYPE = LogicalOperatorType::LOGICAL_USE_BF;
 
 public:
-#ifdef UseHashFilter
-	LogicalUseBF(vector<shared_ptr<HashFilter>> temp_result);
-#else
-	LogicalUseBF(vector<shared_ptr<BlockedBloomFilter>> temp_result);
-#endif
+	LogicalUseBF(vector<shared_ptr<TransferFilter>> temp_result);
 	
-#ifdef UseHashFilter
-	vector<shared_ptr<HashFilter>> bf_to_use;
-#else
-	vector<shared_ptr<BlockedBloomFilter>> bf_to_use;
-#endif
+	vector<shared_ptr<TransferFilter>> bf_to_use;
 	
 	vector<LogicalCreateBF*> related_create_bf;
 
+	//! Set when this UseBF filters an input branch of a set operation: the filters are applied on the columns of
+	//! that set operation, which the branch produces in the same positions
+	idx_t set_operation_index = DConstants::INVALID_INDEX;
+
 public:
 	string ParamsToString() const override;
 	
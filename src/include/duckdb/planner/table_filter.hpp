@@ -22,6 +22,7 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
+	TRANSFER_FILTER = 5, // predicate transfer Bloom or hash filter (e.g. IN BLOOM_FILTER)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -61,6 +61,19 @@ static ConfigurationOption internal_options[] = {DUCKDB_GLOBAL(AccessModeSetting
                                                  DUCKDB_LOCAL(DebugForceNoCrossProduct),
                                                  DUCKDB_LOCAL(DebugAsOfIEJoin),
                                                  DUCKDB_LOCAL(PreferRangeJoins),
+                                                 DUCKDB_LOCAL(JoinOrderAlgorithmSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferModeSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferBloomJoinFilterSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferFilterSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferOrderSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferExternalSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferStreamingBuildSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferParallelBloomBuildSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferFalsePositiveRateSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferPrefetchDistanceSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferPipelinedSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferMinBenefitSetting),
+                                                 DUCKDB_LOCAL(PredicateTransferBloomLayoutSetting),
                                                  DUCKDB_GLOBAL(DebugWindowMode),
                                                  DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
                                                  DUCKDB_GLOBAL(DefaultOrderSetting),
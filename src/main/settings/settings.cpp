@@ -237,6 +237,320 @@ Value PreferRangeJoins::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Join Order Algorithm
+//===--------------------------------------------------------------------===//
+void JoinOrderAlgorithmSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).join_order_algorithm = ClientConfig().join_order_algorithm;
+}
+
+void JoinOrderAlgorithmSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "dynamic_programming") {
+		config.join_order_algorithm = JoinOrderAlgorithm::DYNAMIC_PROGRAMMING;
+	} else if (param == "exact_left_deep") {
+		config.join_order_algorithm = JoinOrderAlgorithm::EXACT_LEFT_DEEP;
+	} else if (param == "random_bushy") {
+		config.join_order_algorithm = JoinOrderAlgorithm::RANDOM_BUSHY;
+	} else if (param == "random_left_deep") {
+		config.join_order_algorithm = JoinOrderAlgorithm::RANDOM_LEFT_DEEP;
+	} else {
+		throw ParserException("Unrecognized option for join_order_algorithm, expected dynamic_programming, "
+		                      "exact_left_deep, random_bushy or random_left_deep");
+	}
+}
+
+Value JoinOrderAlgorithmSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).join_order_algorithm) {
+	case JoinOrderAlgorithm::EXACT_LEFT_DEEP:
+		return "exact_left_deep";
+	case JoinOrderAlgorithm::RANDOM_BUSHY:
+		return "random_bushy";
+	case JoinOrderAlgorithm::RANDOM_LEFT_DEEP:
+		return "random_left_deep";
+	default:
+		return "dynamic_programming";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Mode
+//===--------------------------------------------------------------------===//
+void PredicateTransferModeSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).predicate_transfer_mode = ClientConfig().predicate_transfer_mode;
+}
+
+void PredicateTransferModeSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "predicate_transfer") {
+		config.predicate_transfer_mode = PredicateTransferMode::PREDICATE_TRANSFER;
+	} else if (param == "bloom_join") {
+		config.predicate_transfer_mode = PredicateTransferMode::BLOOM_JOIN;
+	} else if (param == "none") {
+		config.predicate_transfer_mode = PredicateTransferMode::NONE;
+	} else {
+		throw ParserException(
+		    "Unrecognized option for predicate_transfer_mode, expected predicate_transfer, bloom_join or none");
+	}
+}
+
+Value PredicateTransferModeSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).predicate_transfer_mode) {
+	case PredicateTransferMode::BLOOM_JOIN:
+		return "bloom_join";
+	case PredicateTransferMode::NONE:
+		return "none";
+	default:
+		return "predicate_transfer";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Bloom Join Filter
+//===--------------------------------------------------------------------===//
+void PredicateTransferBloomJoinFilterSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).bloom_join_filter_mode = ClientConfig().bloom_join_filter_mode;
+}
+
+void PredicateTransferBloomJoinFilterSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "auto") {
+		config.bloom_join_filter_mode = BloomJoinFilterMode::AUTO;
+	} else if (param == "always") {
+		config.bloom_join_filter_mode = BloomJoinFilterMode::ALWAYS;
+	} else if (param == "never") {
+		config.bloom_join_filter_mode = BloomJoinFilterMode::NEVER;
+	} else {
+		throw ParserException(
+		    "Unrecognized option for predicate_transfer_bloom_join_filter, expected auto, always or never");
+	}
+}
+
+Value PredicateTransferBloomJoinFilterSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).bloom_join_filter_mode) {
+	case BloomJoinFilterMode::ALWAYS:
+		return "always";
+	case BloomJoinFilterMode::NEVER:
+		return "never";
+	default:
+		return "auto";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Filter
+//===--------------------------------------------------------------------===//
+void PredicateTransferFilterSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_filter_type = ClientConfig().transfer_filter_type;
+}
+
+void PredicateTransferFilterSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "bloom") {
+		config.transfer_filter_type = TransferFilterType::BLOOM_FILTER;
+	} else if (param == "hash") {
+		config.transfer_filter_type = TransferFilterType::HASH_FILTER;
+	} else {
+		throw ParserException("Unrecognized option for predicate_transfer_filter, expected bloom or hash");
+	}
+}
+
+Value PredicateTransferFilterSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).transfer_filter_type) {
+	case TransferFilterType::HASH_FILTER:
+		return "hash";
+	default:
+		return "bloom";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Order
+//===--------------------------------------------------------------------===//
+void PredicateTransferOrderSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_order_strategy = ClientConfig().transfer_order_strategy;
+}
+
+void PredicateTransferOrderSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "largest_root") {
+		config.transfer_order_strategy = TransferOrderStrategy::LARGEST_ROOT;
+	} else if (param == "small_to_large") {
+		config.transfer_order_strategy = TransferOrderStrategy::SMALL_TO_LARGE;
+	} else if (param == "bushy") {
+		config.transfer_order_strategy = TransferOrderStrategy::BUSHY;
+	} else {
+		throw ParserException(
+		    "Unrecognized option for predicate_transfer_order, expected largest_root, small_to_large or bushy");
+	}
+}
+
+Value PredicateTransferOrderSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).transfer_order_strategy) {
+	case TransferOrderStrategy::SMALL_TO_LARGE:
+		return "small_to_large";
+	case TransferOrderStrategy::BUSHY:
+		return "bushy";
+	default:
+		return "largest_root";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer External
+//===--------------------------------------------------------------------===//
+void PredicateTransferExternalSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_external = ClientConfig().transfer_external;
+}
+
+void PredicateTransferExternalSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).transfer_external = input.GetValue<bool>();
+}
+
+Value PredicateTransferExternalSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).transfer_external);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Streaming Build
+//===--------------------------------------------------------------------===//
+void PredicateTransferStreamingBuildSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_streaming_build = ClientConfig().transfer_streaming_build;
+}
+
+void PredicateTransferStreamingBuildSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).transfer_streaming_build = input.GetValue<bool>();
+}
+
+Value PredicateTransferStreamingBuildSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).transfer_streaming_build);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Parallel Bloom Build
+//===--------------------------------------------------------------------===//
+void PredicateTransferParallelBloomBuildSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_parallel_bloom_build = ClientConfig().transfer_parallel_bloom_build;
+}
+
+void PredicateTransferParallelBloomBuildSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).transfer_parallel_bloom_build = input.GetValue<bool>();
+}
+
+Value PredicateTransferParallelBloomBuildSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).transfer_parallel_bloom_build);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer False Positive Rate
+//===--------------------------------------------------------------------===//
+void PredicateTransferFalsePositiveRateSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_false_positive_rate = ClientConfig().transfer_false_positive_rate;
+}
+
+void PredicateTransferFalsePositiveRateSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto rate = input.GetValue<double>();
+	if (rate <= 0 || rate >= 1) {
+		throw InvalidInputException("predicate_transfer_false_positive_rate must be between 0 and 1 (exclusive)");
+	}
+	ClientConfig::GetConfig(context).transfer_false_positive_rate = rate;
+}
+
+Value PredicateTransferFalsePositiveRateSetting::GetSetting(ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).transfer_false_positive_rate);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Bloom Layout
+//===--------------------------------------------------------------------===//
+void PredicateTransferBloomLayoutSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_bloom_layout = ClientConfig().transfer_bloom_layout;
+}
+
+void PredicateTransferBloomLayoutSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto param = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (param == "auto") {
+		config.transfer_bloom_layout = BloomFilterLayout::AUTO;
+	} else if (param == "register_blocked") {
+		config.transfer_bloom_layout = BloomFilterLayout::REGISTER_BLOCKED;
+	} else if (param == "sectorized") {
+		config.transfer_bloom_layout = BloomFilterLayout::SECTORIZED;
+	} else {
+		throw ParserException(
+		    "Unrecognized option for predicate_transfer_bloom_layout, expected auto, register_blocked or sectorized");
+	}
+}
+
+Value PredicateTransferBloomLayoutSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).transfer_bloom_layout) {
+	case BloomFilterLayout::REGISTER_BLOCKED:
+		return "register_blocked";
+	case BloomFilterLayout::SECTORIZED:
+		return "sectorized";
+	default:
+		return "auto";
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Pipelined
+//===--------------------------------------------------------------------===//
+void PredicateTransferPipelinedSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_pipelined = ClientConfig().transfer_pipelined;
+}
+
+void PredicateTransferPipelinedSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).transfer_pipelined = input.GetValue<bool>();
+}
+
+Value PredicateTransferPipelinedSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).transfer_pipelined);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Prefetch Distance
+//===--------------------------------------------------------------------===//
+void PredicateTransferPrefetchDistanceSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_prefetch_distance = ClientConfig().transfer_prefetch_distance;
+}
+
+void PredicateTransferPrefetchDistanceSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto distance = input.GetValue<uint64_t>();
+	if (distance > STANDARD_VECTOR_SIZE) {
+		throw InvalidInputException("predicate_transfer_prefetch_distance must be at most %d", STANDARD_VECTOR_SIZE);
+	}
+	ClientConfig::GetConfig(context).transfer_prefetch_distance = distance;
+}
+
+Value PredicateTransferPrefetchDistanceSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).transfer_prefetch_distance);
+}
+
+//===--------------------------------------------------------------------===//
+// Predicate Transfer Min Benefit
+//===--------------------------------------------------------------------===//
+void PredicateTransferMinBenefitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).transfer_min_benefit = ClientConfig().transfer_min_benefit;
+}
+
+void PredicateTransferMinBenefitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto benefit = input.GetValue<double>();
+	if (benefit < 0 || benefit > 1) {
+		throw InvalidInputException("predicate_transfer_min_benefit must be between 0 and 1");
+	}
+	ClientConfig::GetConfig(context).transfer_min_benefit = benefit;
+}
+
+Value PredicateTransferMinBenefitSetting::GetSetting(ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).transfer_min_benefit);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
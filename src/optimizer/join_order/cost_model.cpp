@@ -1,7 +1,7 @@
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/cost_model.hpp"
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
 
@@ -16,11 +16,11 @@ double CostModel::ComputeCost(JoinNode &left, JoinNode &right) {
 	auto &combination = query_graph_manager.set_manager.Union(left.set, right.set);
 	auto join_card = cardinality_estimator.EstimateCardinalityWithSet<double>(combination);
 	auto join_cost = join_card;
-#ifdef ExactLeftDeep
-	return join_cost + left.cost + 1.2 * right.cost;
-#else
+	if (ClientConfig::GetConfig(query_graph_manager.context).join_order_algorithm ==
+	    JoinOrderAlgorithm::EXACT_LEFT_DEEP) {
+		return join_cost + left.cost + 1.2 * right.cost;
+	}
 	return join_cost + left.cost + right.cost;
-#endif
 }
 
 } // namespace duckdb
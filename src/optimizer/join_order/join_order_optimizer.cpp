@@ -7,8 +7,7 @@
 #include "duckdb/planner/expression/list.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/list.hpp"
-
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
 
@@ -50,15 +49,21 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 		plan_enumerator.InitLeafPlans();
 
 		// Ask the plan enumerator to enumerate a number of join orders
-#ifdef ExactLeftDeep
-		auto final_plan = plan_enumerator.SolveJoinOrderLeftDeep();
-#elif defined(RandomBushy)
-		auto final_plan = plan_enumerator.SolveJoinOrderRandom();
-#elif defined(RandomLeftDeep)
-		auto final_plan = plan_enumerator.SolveJoinOrderLeftDeepRandom();
-#else
-		auto final_plan = plan_enumerator.SolveJoinOrder();
-#endif
+		unique_ptr<JoinNode> final_plan;
+		switch (ClientConfig::GetConfig(context).join_order_algorithm) {
+		case JoinOrderAlgorithm::EXACT_LEFT_DEEP:
+			final_plan = plan_enumerator.SolveJoinOrderLeftDeep();
+			break;
+		case JoinOrderAlgorithm::RANDOM_BUSHY:
+			final_plan = plan_enumerator.SolveJoinOrderRandom();
+			break;
+		case JoinOrderAlgorithm::RANDOM_LEFT_DEEP:
+			final_plan = plan_enumerator.SolveJoinOrderLeftDeepRandom();
+			break;
+		default:
+			final_plan = plan_enumerator.SolveJoinOrder();
+			break;
+		}
 		// TODO: add in the check that if no plan exists, you have to add a cross product.
 
 		// now reconstruct a logical plan from the query graph plan
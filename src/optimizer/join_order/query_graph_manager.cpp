@@ -10,8 +10,7 @@
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 #include "duckdb/planner/operator/list.hpp"
-
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
 
@@ -378,11 +377,12 @@ unique_ptr<LogicalOperator> QueryGraphManager::LeftRightOptimizations(unique_ptr
 
 				switch (join.join_type) {
 				case JoinType::INNER: {
-#if defined(ExactLeftDeep) || defined(RandomBushy) || defined(RandomLeftDeep)
-					if (join.children[0]->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN || join.children[1]->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+					if (ClientConfig::GetConfig(context).join_order_algorithm !=
+					        JoinOrderAlgorithm::DYNAMIC_PROGRAMMING &&
+					    (join.children[0]->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN ||
+					     join.children[1]->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN)) {
 						break;
 					}
-#endif
 					TryFlipChildren(join);
 					break;
 				}
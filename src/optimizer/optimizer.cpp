@@ -26,8 +26,7 @@
 #include "duckdb/optimizer/unnest_rewriter.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/planner.hpp"
-
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
 
@@ -123,10 +122,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 
 	// then we start the first phase of predicate transfer optimization,
 	// building the transfer graph
-#ifdef PredicateTransfer
+	bool predicate_transfer =
+	    ClientConfig::GetConfig(context).predicate_transfer_mode == PredicateTransferMode::PREDICATE_TRANSFER;
 	PredicateTransferOptimizer PT(context);
-	plan = PT.PreOptimize(std::move(plan));
-#endif
+	if (predicate_transfer) {
+		plan = PT.PreOptimize(std::move(plan));
+	}
 
 	// then we perform the join ordering optimization
 	// this also rewrites cross products + filters into joins and performs filter pushdowns
@@ -136,9 +137,9 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		plan = optimizer.Optimize(std::move(plan));
 	});
 
-#ifdef PredicateTransfer
-	plan = PT.Optimize(std::move(plan));
-#endif
+	if (predicate_transfer) {
+		plan = PT.Optimize(std::move(plan));
+	}
 
 	// rewrites UNNESTs in DelimJoins by moving them to the projection
 	RunOptimizer(OptimizerType::UNNEST_REWRITER, [&]() {
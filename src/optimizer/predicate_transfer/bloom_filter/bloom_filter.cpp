@@ -4,7 +4,9 @@
 #include "arrow/util/bit_util.h"    // Log2
 #include "arrow/util/bitmap_ops.h"  // CountSetBits
 #include "arrow/util/config.h"
+#include "arrow/util/cpu_info.h"    // CacheSize
 
+#include <cmath>
 #include <iostream>
 
 namespace duckdb {
@@ -75,22 +77,87 @@ BloomFilterMasks::BloomFilterMasks() {
 
 BloomFilterMasks BlockedBloomFilter::masks_;
 
+constexpr uint32_t SectorizedLayout::kSalt[8];
+
+double BlockedBloomFilter::ExpectedFalsePositiveRate(BloomFilterLayout layout, double bits_per_key) {
+  const bool sectorized = layout == BloomFilterLayout::SECTORIZED;
+  const double keys_per_block = (sectorized ? 256.0 : 64.0) / bits_per_key;
+  const double mask_bits = (BloomFilterMasks::kMinBitsSet + BloomFilterMasks::kMaxBitsSet) / 2.0;
+  const int max_keys = static_cast<int>(keys_per_block + 10 * std::sqrt(keys_per_block)) + 10;
+  double result = 0;
+  // probability that a block holds `keys` keys
+  double block_probability = std::exp(-keys_per_block);
+  for (int keys = 0; keys <= max_keys; ++keys) {
+    double false_positive_rate;
+    if (sectorized) {
+      // each key sets one of the 32 bits of each of the 8 words
+      false_positive_rate = std::pow(1 - std::pow(1 - 1.0 / 32, keys), 8);
+    } else {
+      // each key sets about mask_bits of the 64 bits
+      false_positive_rate = std::pow(1 - std::pow(1 - 1.0 / 64, mask_bits * keys), mask_bits);
+    }
+    result += block_probability * false_positive_rate;
+    block_probability *= keys_per_block / (keys + 1);
+  }
+  return result;
+}
+
+BloomFilterLayout BlockedBloomFilter::ChooseLayout(int64_t num_bits, int64_t num_keys) const {
+  if (requested_layout_ != BloomFilterLayout::AUTO) {
+    return requested_layout_;
+  }
+  // register blocking probes a single word: keep it as long as it reaches the target rate
+  const double bits_per_key = static_cast<double>(num_bits) / std::max<int64_t>(num_keys, 1);
+  const double register_blocked_rate = ExpectedFalsePositiveRate(BloomFilterLayout::REGISTER_BLOCKED, bits_per_key);
+  if (register_blocked_rate <= false_positive_rate_) {
+    return BloomFilterLayout::REGISTER_BLOCKED;
+  }
+  const double sectorized_rate = ExpectedFalsePositiveRate(BloomFilterLayout::SECTORIZED, bits_per_key);
+  return sectorized_rate < register_blocked_rate ? BloomFilterLayout::SECTORIZED
+                                                 : BloomFilterLayout::REGISTER_BLOCKED;
+}
+
+int64_t BlockedBloomFilter::NumBitsToAllocate(int64_t num_keys) const {
+  constexpr int64_t min_num_bits = 512;
+  // Bits per key of a Bloom filter with the optimal number of hash functions
+  const double ln2 = std::log(2.0);
+  double bits_per_key = -std::log(false_positive_rate_) / (ln2 * ln2);
+  bits_per_key = std::min<double>(kMaxNumBitsPerKey, std::max<double>(kMinNumBitsPerKeyInCache, bits_per_key));
+  int64_t desired_num_bits =
+      std::max(min_num_bits, static_cast<int64_t>(std::ceil(num_keys * bits_per_key)));
+  int64_t num_bits = 1LL << arrow::bit_util::Log2(desired_num_bits);
+
+  const auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+  const int64_t l2_bits = cpu_info->CacheSize(arrow::internal::CpuInfo::CacheLevel::L2) * 8;
+  const int64_t llc_bits = cpu_info->CacheSize(arrow::internal::CpuInfo::CacheLevel::L3) * 8;
+  if (llc_bits > 0) {
+    while (num_bits > llc_bits && num_bits / 2 >= min_num_bits &&
+           num_bits / 2 >= num_keys * kMinNumBitsPerKeyInCache) {
+      num_bits /= 2;
+    }
+  }
+  const int64_t num_probe_rows = static_cast<int64_t>(probe_cardinality_);
+  if (l2_bits > 0 && num_probe_rows > num_keys) {
+    while (num_bits * 2 <= l2_bits && num_bits * 2 <= num_keys * kMaxNumBitsPerKey) {
+      num_bits *= 2;
+    }
+  }
+  return num_bits;
+}
+
 arrow::Status BlockedBloomFilter::CreateEmpty(int64_t num_rows_to_insert, arrow::MemoryPool* pool) {
   // Compute the size
   //
-  constexpr int64_t min_num_bits_per_key = 8;
-  // constexpr int64_t min_num_bits_per_key = 16;
-  constexpr int64_t min_num_bits = 512;
-  int64_t desired_num_bits =
-      std::max(min_num_bits, num_rows_to_insert * min_num_bits_per_key);
-  int log_num_bits = arrow::bit_util::Log2(desired_num_bits);
+  int64_t num_bits = NumBitsToAllocate(num_rows_to_insert);
+  int log_num_bits = arrow::bit_util::Log2(num_bits);
 
-  log_num_blocks_ = log_num_bits - 6;
+  layout_ = ChooseLayout(num_bits, num_rows_to_insert);
+  log_num_blocks_ = log_num_bits - kLogBlockBitsOf(layout_);
   num_blocks_ = 1ULL << log_num_blocks_;
 
   // Allocate and zero out bit vector
   //
-  int64_t buffer_size = num_blocks_ * sizeof(uint64_t);
+  int64_t buffer_size = num_words() * sizeof(uint64_t);
   ARROW_ASSIGN_OR_RAISE(buf_, AllocateBuffer(buffer_size, pool));
   
   // blocks_ = reinterpret_cast<uint64_t*>(buf_->mutable_data());
@@ -100,83 +167,74 @@ arrow::Status BlockedBloomFilter::CreateEmpty(int64_t num_rows_to_insert, arrow:
   return arrow::Status::OK();
 }
 
-template <typename T>
-void BlockedBloomFilter::InsertImp(int64_t num_rows, const T* hashes) {
+template <class LAYOUT>
+void BlockedBloomFilter::InsertImp(int64_t num_rows, const uint64_t* hashes) {
   for (int64_t i = 0; i < num_rows; ++i) {
-    Insert(hashes[i]);
+    InsertHash<LAYOUT>(hashes[i]);
   }
 }
 
-void BlockedBloomFilter::Insert(int64_t hardware_flags, int64_t num_rows,
-                                const uint64_t* hashes) {
+template <class LAYOUT>
+void BlockedBloomFilter::InsertLayout(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes) {
   int64_t num_processed = 0;
   if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
-    num_processed = Insert_avx2(num_rows, hashes);
+    num_processed = Insert_avx2<LAYOUT>(num_rows, hashes);
   }
-  InsertImp(num_rows - num_processed, hashes + num_processed);
-}
-
-static inline int trailingzeroes(uint64_t input_num) {
-#ifdef __BMI2__
-  return _tzcnt_u64(input_num);
-#else
-  return __builtin_ctzll(input_num);
-#endif
+  InsertImp<LAYOUT>(num_rows - num_processed, hashes + num_processed);
 }
 
-inline void basic_decoder(SelectionVector &sel, idx_t &result_count, uint32_t idx,
-                          uint64_t bits) {
-  while (bits != 0) {
-    uint32_t value = static_cast<uint32_t>(idx) + trailingzeroes(bits);
-    sel.set_index(result_count, value);
-    bits = bits & (bits - 1);
-    result_count++;
+void BlockedBloomFilter::Insert(int64_t hardware_flags, int64_t num_rows,
+                                const uint64_t* hashes) {
+  if (layout_ == BloomFilterLayout::SECTORIZED) {
+    InsertLayout<SectorizedLayout>(hardware_flags, num_rows, hashes);
+  } else {
+    InsertLayout<RegisterBlockedLayout>(hardware_flags, num_rows, hashes);
   }
 }
 
+template <class LAYOUT>
 void BlockedBloomFilter::FindImp(int64_t num_rows, int64_t num_preprocessed, const uint64_t* hashes, SelectionVector &sel,
-                                 idx_t &result_count, bool enable_prefetch) const {
+                                 idx_t &result_count, int64_t prefetch_distance) const {
   int64_t num_processed = 0;
-  if (enable_prefetch && UsePrefetch()) {
-    constexpr int kPrefetchIterations = 16;
-    for (int64_t i = 0; i < num_rows - kPrefetchIterations; ++i) {
-      PREFETCH(blocks_ + block_id(hashes[i + kPrefetchIterations]));
-      bool result = Find(hashes[i]);
-      sel.set_index(result_count, i);
+  if (prefetch_distance > 0) {
+    for (int64_t i = 0; i < num_rows - prefetch_distance; ++i) {
+      PREFETCH(blocks_ + block_id(hashes[i + prefetch_distance]) * LAYOUT::kWordsPerBlock);
+      bool result = FindHash<LAYOUT>(hashes[i]);
+      sel.set_index(result_count, i + num_preprocessed);
       result_count += result;
     }
-    num_processed = num_rows - kPrefetchIterations;
-  }
-  
-  if(num_processed < 0) {
-    num_processed = 0;
+    num_processed = std::max<int64_t>(num_rows - prefetch_distance, 0);
   }
   for (int64_t i = num_processed; i < num_rows; i++) {
-    bool result = Find(hashes[i]);
+    bool result = FindHash<LAYOUT>(hashes[i]);
     sel.set_index(result_count, i + num_preprocessed);
     result_count += result;
   }
 }
 
-void BlockedBloomFilter::Find(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes,
-                              SelectionVector &sel, idx_t &result_count, bool enable_prefetch) const {
+template <class LAYOUT>
+void BlockedBloomFilter::FindLayout(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes,
+                                    SelectionVector &sel, idx_t &result_count, bool enable_prefetch) const {
+  // filters that fit the cache gain nothing from prefetching
+  const int64_t prefetch_distance = enable_prefetch && UsePrefetch() ? prefetch_distance_ : 0;
   int64_t num_processed = 0;
 
-  if (!(enable_prefetch && UsePrefetch()) && (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
-    uint8_t *result_bit_vector = new uint8_t[num_rows / 8 + 8];
-    memset(result_bit_vector, 0, num_rows / 8 + 8);
-    num_processed = Find_avx2(num_rows, hashes, result_bit_vector);
-    for (uint32_t i = 0; i < num_rows / 64 + 1; i++) {
-      uint64_t bits = ((uint64_t*)result_bit_vector)[i];
-      basic_decoder(sel, result_count, 64 * i, bits);
-    }
-    num_processed -= (num_processed % 8);
-    delete[] result_bit_vector;
+  if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
+    num_processed = Find_avx2<LAYOUT>(num_rows, hashes, prefetch_distance, sel, result_count);
   }
 
   ARROW_DCHECK(num_processed % 8 == 0);
-  FindImp(num_rows - num_processed, num_processed, hashes + num_processed,
-          sel, result_count, enable_prefetch);
+  FindImp<LAYOUT>(num_rows - num_processed, num_processed, hashes + num_processed,
+                  sel, result_count, prefetch_distance);
+}
+
+void BlockedBloomFilter::Find(int64_t hardware_flags, int64_t num_rows, const uint64_t* hashes,
+                              SelectionVector &sel, idx_t &result_count, bool enable_prefetch) const {
+  if (layout_ == BloomFilterLayout::SECTORIZED) {
+    FindLayout<SectorizedLayout>(hardware_flags, num_rows, hashes, sel, result_count, enable_prefetch);
+  } else {
+    FindLayout<RegisterBlockedLayout>(hardware_flags, num_rows, hashes, sel, result_count, enable_prefetch);
+  }
 }
 
 void BlockedBloomFilter::Fold() {
@@ -189,7 +247,7 @@ void BlockedBloomFilter::Fold() {
       break;
     }
 
-    int64_t num_bits = num_blocks_ * 64;
+    int64_t num_bits = num_words() * 64;
 
     // Calculate the number of bits set in this blocked Bloom filter
     int64_t num_bits_set = 0;
@@ -222,7 +280,7 @@ void BlockedBloomFilter::SingleFold(int num_folds) {
   // Calculate number of slices and size of a slice
   //
   int64_t num_slices = 1LL << num_folds;
-  int64_t num_slice_blocks = (num_blocks_ >> num_folds);
+  int64_t num_slice_words = (num_words() >> num_folds);
   
   // uint64_t* target_slice = blocks_;
   std::atomic<uint64_t>* target_slice = blocks_;
@@ -230,9 +288,9 @@ void BlockedBloomFilter::SingleFold(int num_folds) {
   // OR bits of all the slices and store result in the first slice
   //
   for (int64_t slice = 1; slice < num_slices; ++slice) {
-    // const uint64_t* source_slice = blocks_ + slice * num_slice_blocks;
-    std::atomic<uint64_t>* source_slice = blocks_ + slice * num_slice_blocks;
-    for (int i = 0; i < num_slice_blocks; ++i) {
+    // const uint64_t* source_slice = blocks_ + slice * num_slice_words;
+    std::atomic<uint64_t>* source_slice = blocks_ + slice * num_slice_words;
+    for (int i = 0; i < num_slice_words; ++i) {
       target_slice[i] |= source_slice[i];
     }
   }
@@ -242,23 +300,23 @@ void BlockedBloomFilter::SingleFold(int num_folds) {
 }
 
 int BlockedBloomFilter::NumHashBitsUsed() const {
-  constexpr int num_bits_for_mask = (BloomFilterMasks::kLogNumMasks + 6);
+  constexpr int num_bits_for_mask = kBlockIdBitOffset;
   int num_bits_for_block = log_num_blocks();
   return num_bits_for_mask + num_bits_for_block;
 }
 
 bool BlockedBloomFilter::IsSameAs(const BlockedBloomFilter* other) const {
-  if (log_num_blocks_ != other->log_num_blocks_ || num_blocks_ != other->num_blocks_) {
+  if (layout_ != other->layout_ || log_num_blocks_ != other->log_num_blocks_ || num_blocks_ != other->num_blocks_) {
     return false;
   }
-  if (memcmp(blocks_, other->blocks_, num_blocks_ * sizeof(uint64_t)) != 0) {
+  if (memcmp(blocks_, other->blocks_, num_words() * sizeof(uint64_t)) != 0) {
     return false;
   }
   return true;
 }
 
 int64_t BlockedBloomFilter::NumBitsSet() const {
-  return arrow::internal::CountSetBits(reinterpret_cast<const uint8_t*>(blocks_), 0, (1LL << log_num_blocks()) * 64);
+  return arrow::internal::CountSetBits(reinterpret_cast<const uint8_t*>(blocks_), 0, num_words() * 64);
 }
 
 arrow::Status BloomFilterBuilder_SingleThreaded::Begin(size_t /*num_threads*/,
@@ -280,7 +338,7 @@ arrow::Status BloomFilterBuilder_SingleThreaded::PushNextBatch(size_t /*thread_i
   return arrow::Status::OK();
 }
 
-vector<idx_t> BloomFilterBuilder_SingleThreaded::BuiltCols() {
+const vector<idx_t> &BloomFilterBuilder_SingleThreaded::BuiltCols() const {
   return build_target_->BoundColsBuilt;
 }
 
@@ -298,7 +356,7 @@ arrow::Status BloomFilterBuilder_Parallel::Begin(size_t num_threads, int64_t har
   total_row_nums_ = num_rows;
 
   constexpr int kMaxLogNumPrtns = 8;
-  log_num_prtns_ = std::min(kMaxLogNumPrtns, arrow::bit_util::Log2(num_threads));
+  log_num_prtns_ = std::min(kMaxLogNumPrtns, arrow::bit_util::Log2(num_threads) + kLogNumPrtnsPerThread);
 
   thread_local_states_.resize(num_threads);
   prtn_locks_.Init(num_threads, 1 << log_num_prtns_);
@@ -314,7 +372,7 @@ arrow::Status BloomFilterBuilder_Parallel::PushNextBatch(size_t thread_id, int64
   return arrow::Status::OK();
 }
 
-vector<idx_t> BloomFilterBuilder_Parallel::BuiltCols() {
+const vector<idx_t> &BloomFilterBuilder_Parallel::BuiltCols() const {
   return build_target_->BoundColsBuilt;
 }
 
@@ -324,8 +382,7 @@ void BloomFilterBuilder_Parallel::PushNextBatchImp(size_t thread_id, int64_t num
   // ensures that each block is contained entirely within a partition and prevents
   // concurrent access to a block.
   constexpr int kLogBlocksKeptTogether = 7;
-  constexpr int kPrtnIdBitOffset =
-      BloomFilterMasks::kLogNumMasks + 6 + kLogBlocksKeptTogether;
+  constexpr int kPrtnIdBitOffset = kBlockIdBitOffset + kLogBlocksKeptTogether;
 
   const int log_num_prtns_max =
       std::max(0, build_target_->log_num_blocks() - kLogBlocksKeptTogether);
@@ -339,14 +396,6 @@ void BloomFilterBuilder_Parallel::PushNextBatchImp(size_t thread_id, int64_t num
   uint16_t* partition_ranges = local_state.partition_ranges.data();
   uint64_t* partitioned_hashes = local_state.partitioned_hashes_64.data();
   int* unprocessed_partition_ids = local_state.unprocessed_partition_ids.data();
-  
-  /*
-  if(local_state.local_bf == nullptr) {
-    ColumnBinding col_bind(0, 0);
-    local_state.local_bf = make_shared<BlockedBloomFilter>(col_bind);
-    local_state.local_bf->CreateEmpty(total_row_nums_, arrow::default_memory_pool());
-  }
-  */
 
   PartitionSort::Eval(
       num_rows, num_prtns, partition_ranges,
@@ -364,18 +413,19 @@ void BloomFilterBuilder_Parallel::PushNextBatchImp(size_t thread_id, int64_t num
       unprocessed_partition_ids[num_unprocessed_partitions++] = i;
     }
   }
+  // Claim whichever of our non-empty partitions is free, so that every block
+  // is written by a single thread at a time and no atomic RMW is needed.
   while (num_unprocessed_partitions > 0) {
     int locked_prtn_id;
     int locked_prtn_id_pos;
-    locked_prtn_id_pos = 0;
-    locked_prtn_id = unprocessed_partition_ids[locked_prtn_id_pos];
-    // prtn_locks_.AcquirePartitionLock(thread_id, num_unprocessed_partitions, unprocessed_partition_ids, false, -1, &locked_prtn_id, &locked_prtn_id_pos);
+    prtn_locks_.AcquirePartitionLock(thread_id, num_unprocessed_partitions, unprocessed_partition_ids,
+                                     /*limit_retries=*/false, /*max_retries=*/-1, &locked_prtn_id,
+                                     &locked_prtn_id_pos);
     build_target_->Insert(
-    // local_state.local_bf->Insert(
         hardware_flags_,
         partition_ranges[locked_prtn_id + 1] - partition_ranges[locked_prtn_id],
         partitioned_hashes + partition_ranges[locked_prtn_id]);
-    // prtn_locks_.ReleasePartitionLock(locked_prtn_id);
+    prtn_locks_.ReleasePartitionLock(locked_prtn_id);
     if (locked_prtn_id_pos < num_unprocessed_partitions - 1) {
       unprocessed_partition_ids[locked_prtn_id_pos] =
           unprocessed_partition_ids[num_unprocessed_partitions - 1];
@@ -390,6 +440,7 @@ void BloomFilterBuilder_Parallel::CleanUp() {
 }
 
 void BloomFilterBuilder_Parallel::Merge() {
-
+  // Nothing to merge: all threads insert into build_target_ directly,
+  // serialized per partition by prtn_locks_.
 }
 }
\ No newline at end of file
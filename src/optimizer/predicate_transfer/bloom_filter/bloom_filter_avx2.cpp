@@ -30,18 +30,46 @@ inline __m256i BlockedBloomFilter::mask_avx2(__m256i hash) const {
 inline __m256i BlockedBloomFilter::block_id_avx2(__m256i hash) const {
   // AVX2 translation of block_id() method
   //
-  __m256i result = _mm256_srli_epi64(hash, BloomFilterMasks::kLogNumMasks + 6);
+  __m256i result = _mm256_srli_epi64(hash, kBlockIdBitOffset);
   result = _mm256_and_si256(result, _mm256_set1_epi64x(num_blocks_ - 1));
   return result;
 }
 
-int64_t BlockedBloomFilter::FindImp_avx2(int64_t num_rows, const uint64_t* hashes,
-                                         uint8_t* result_bit_vector) const {
+// Appends the rows of one batch of 8 hashes whose bit in `bits` is set;
+// branch-free, like the scalar FindImp
+static inline void AppendMatches(SelectionVector &sel, idx_t &result_count, int64_t first_row, uint32_t bits) {
+  for (int j = 0; j < 8; ++j) {
+    sel.set_index(result_count, static_cast<idx_t>(first_row + j));
+    result_count += (bits >> j) & 1;
+  }
+}
+
+// Issues the prefetches for the batch of 8 hashes starting at `hashes`
+#define PREFETCH_BATCH(hashes, words_per_block)                          \
+  do {                                                                   \
+    for (int j = 0; j < 8; ++j) {                                        \
+      PREFETCH(blocks_ + block_id((hashes)[j]) * (words_per_block));     \
+    }                                                                    \
+  } while (0)
+
+template <>
+int64_t BlockedBloomFilter::Find_avx2<RegisterBlockedLayout>(int64_t num_rows, const uint64_t* hashes,
+                                                             int64_t prefetch_distance, SelectionVector &sel,
+                                                             idx_t &result_count) const {
+#ifdef __AVX512F__
+  return Find_avx512(num_rows, hashes, prefetch_distance, sel, result_count);
+#else
   constexpr int unroll = 8;
 
   auto blocks = reinterpret_cast<const arrow::util::int64_for_gather_t*>(blocks_);
+  const int64_t num_batches = num_rows / unroll;
+  // prefetch whole batches, rounding the distance up
+  const int64_t prefetch_batches = (prefetch_distance + unroll - 1) / unroll;
 
-  for (int64_t i = 0; i < num_rows / unroll; ++i) {
+  for (int64_t i = 0; i < num_batches; ++i) {
+    if (prefetch_batches > 0 && i + prefetch_batches < num_batches) {
+      PREFETCH_BATCH(hashes + (i + prefetch_batches) * unroll, 1);
+    }
     __m256i hash_A, hash_B;
     hash_A = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + 2 * i + 0);
     hash_B = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + 2 * i + 1);
@@ -51,48 +79,137 @@ int64_t BlockedBloomFilter::FindImp_avx2(int64_t num_rows, const uint64_t* hashe
     __m256i block_id_B = block_id_avx2(hash_B);
     __m256i block_A = _mm256_i64gather_epi64(blocks, block_id_A, sizeof(uint64_t));
     __m256i block_B = _mm256_i64gather_epi64(blocks, block_id_B, sizeof(uint64_t));
-    uint64_t result_bytes = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_and_si256(block_A, mask_A), mask_A)));
-    result_bytes |= static_cast<uint64_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_and_si256(block_B, mask_B), mask_B))) << 32;
-    result_bit_vector[i] = static_cast<uint8_t>(_mm256_movemask_epi8(_mm256_set1_epi64x(result_bytes)));
+    uint32_t bits = static_cast<uint32_t>(_mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(block_A, mask_A), mask_A))));
+    bits |= static_cast<uint32_t>(_mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(block_B, mask_B), mask_B))))
+            << 4;
+    AppendMatches(sel, result_count, i * unroll, bits);
   }
 
-  return num_rows - (num_rows % unroll);
+  return num_batches * unroll;
+#endif
 }
 
-int64_t BlockedBloomFilter::Find_avx2(int64_t num_rows, const uint64_t* hashes,
-                                      uint8_t* result_bit_vector) const {
-    return FindImp_avx2(num_rows, hashes, result_bit_vector);
+// The eight 32-bit words of a sectorized block hash-selected bits, one per word
+static inline __m256i SectorizedMask(uint64_t hash) {
+  const __m256i salt = _mm256_setr_epi32(
+      static_cast<int>(SectorizedLayout::kSalt[0]), static_cast<int>(SectorizedLayout::kSalt[1]),
+      static_cast<int>(SectorizedLayout::kSalt[2]), static_cast<int>(SectorizedLayout::kSalt[3]),
+      static_cast<int>(SectorizedLayout::kSalt[4]), static_cast<int>(SectorizedLayout::kSalt[5]),
+      static_cast<int>(SectorizedLayout::kSalt[6]), static_cast<int>(SectorizedLayout::kSalt[7]));
+  __m256i key = _mm256_set1_epi32(static_cast<int>(SectorizedLayout::Key(hash)));
+  __m256i bit = _mm256_srli_epi32(_mm256_mullo_epi32(key, salt), 27);
+  return _mm256_sllv_epi32(_mm256_set1_epi32(1), bit);
 }
 
-template <typename T>
-int64_t BlockedBloomFilter::InsertImp_avx2(int64_t num_rows, const T* hashes) {
+template <>
+int64_t BlockedBloomFilter::Find_avx2<SectorizedLayout>(int64_t num_rows, const uint64_t* hashes,
+                                                        int64_t prefetch_distance, SelectionVector &sel,
+                                                        idx_t &result_count) const {
+  constexpr int unroll = 8;
+
+  // a block is one 256-bit register: no gather, a single load per hash
+  auto blocks = reinterpret_cast<const __m256i*>(blocks_);
+  const int64_t num_batches = num_rows / unroll;
+  const int64_t prefetch_batches = (prefetch_distance + unroll - 1) / unroll;
+
+  for (int64_t i = 0; i < num_batches; ++i) {
+    if (prefetch_batches > 0 && i + prefetch_batches < num_batches) {
+      PREFETCH_BATCH(hashes + (i + prefetch_batches) * unroll, SectorizedLayout::kWordsPerBlock);
+    }
+    uint32_t bits = 0;
+    for (int j = 0; j < unroll; ++j) {
+      uint64_t hash = hashes[i * unroll + j];
+      __m256i block = _mm256_loadu_si256(blocks + block_id(hash));
+      bits |= static_cast<uint32_t>(_mm256_testc_si256(block, SectorizedMask(hash))) << j;
+    }
+    AppendMatches(sel, result_count, i * unroll, bits);
+  }
+
+  return num_batches * unroll;
+}
+
+#ifdef __AVX512F__
+inline __m512i BlockedBloomFilter::mask_avx512(__m512i hash) const {
+  // AVX-512 translation of mask() method
+  //
+  __m512i mask_id =
+      _mm512_and_si512(hash, _mm512_set1_epi64(BloomFilterMasks::kNumMasks - 1));
+
+  __m512i mask_byte_index = _mm512_srli_epi64(mask_id, 3);
+  __m512i result = _mm512_i64gather_epi64(mask_byte_index, masks_.masks_, 1);
+  __m512i mask_bit_in_byte_index = _mm512_and_si512(mask_id, _mm512_set1_epi64(7));
+  result = _mm512_srlv_epi64(result, mask_bit_in_byte_index);
+  result = _mm512_and_si512(result, _mm512_set1_epi64(BloomFilterMasks::kFullMask));
+
+  __m512i rotation = _mm512_and_si512(
+      _mm512_srli_epi64(hash, BloomFilterMasks::kLogNumMasks), _mm512_set1_epi64(63));
+
+  return _mm512_rolv_epi64(result, rotation);
+}
+
+inline __m512i BlockedBloomFilter::block_id_avx512(__m512i hash) const {
+  // AVX-512 translation of block_id() method
+  //
+  __m512i result = _mm512_srli_epi64(hash, kBlockIdBitOffset);
+  result = _mm512_and_si512(result, _mm512_set1_epi64(num_blocks_ - 1));
+  return result;
+}
+
+int64_t BlockedBloomFilter::Find_avx512(int64_t num_rows, const uint64_t* hashes, int64_t prefetch_distance,
+                                        SelectionVector &sel, idx_t &result_count) const {
+  constexpr int unroll = 8;
+
+  const int64_t num_batches = num_rows / unroll;
+  const int64_t prefetch_batches = (prefetch_distance + unroll - 1) / unroll;
+
+  for (int64_t i = 0; i < num_batches; ++i) {
+    if (prefetch_batches > 0 && i + prefetch_batches < num_batches) {
+      PREFETCH_BATCH(hashes + (i + prefetch_batches) * unroll, 1);
+    }
+    __m512i hash = _mm512_loadu_si512(hashes + i * unroll);
+    __m512i mask = mask_avx512(hash);
+    __m512i block = _mm512_i64gather_epi64(block_id_avx512(hash), blocks_, sizeof(uint64_t));
+    __mmask8 bits = _mm512_cmpeq_epi64_mask(_mm512_and_si512(block, mask), mask);
+    AppendMatches(sel, result_count, i * unroll, static_cast<uint32_t>(bits));
+  }
+
+  return num_batches * unroll;
+}
+#endif
+
+#undef PREFETCH_BATCH
+
+template <>
+int64_t BlockedBloomFilter::Insert_avx2<RegisterBlockedLayout>(int64_t num_rows, const uint64_t* hashes) {
   constexpr int unroll = 4;
 
   for (int64_t i = 0; i < num_rows / unroll; ++i) {
-    __m256i hash;
-    if (sizeof(T) == sizeof(uint32_t)) {
-      hash = _mm256_cvtepu32_epi64(
-          _mm_loadu_si128(reinterpret_cast<const __m128i*>(hashes) + i));
-    } else {
-      hash = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + i);
-    }
+    __m256i hash = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + i);
     __m256i mask = mask_avx2(hash);
     __m256i block_id = block_id_avx2(hash);
-    blocks_[_mm256_extract_epi64(block_id, 0)].fetch_or(_mm256_extract_epi64(mask, 0));
-    blocks_[_mm256_extract_epi64(block_id, 1)].fetch_or(_mm256_extract_epi64(mask, 1));
-    blocks_[_mm256_extract_epi64(block_id, 2)].fetch_or(_mm256_extract_epi64(mask, 2));
-    blocks_[_mm256_extract_epi64(block_id, 3)].fetch_or(_mm256_extract_epi64(mask, 3));
+    SetBlockBits(_mm256_extract_epi64(block_id, 0), _mm256_extract_epi64(mask, 0));
+    SetBlockBits(_mm256_extract_epi64(block_id, 1), _mm256_extract_epi64(mask, 1));
+    SetBlockBits(_mm256_extract_epi64(block_id, 2), _mm256_extract_epi64(mask, 2));
+    SetBlockBits(_mm256_extract_epi64(block_id, 3), _mm256_extract_epi64(mask, 3));
   }
 
   return num_rows - (num_rows % unroll);
 }
 
-int64_t BlockedBloomFilter::Insert_avx2(int64_t num_rows, const uint32_t* hashes) {
-  return InsertImp_avx2(num_rows, hashes);
-}
+template <>
+int64_t BlockedBloomFilter::Insert_avx2<SectorizedLayout>(int64_t num_rows, const uint64_t* hashes) {
+  for (int64_t i = 0; i < num_rows; ++i) {
+    __m256i mask = SectorizedMask(hashes[i]);
+    const int64_t first_word = block_id(hashes[i]) * SectorizedLayout::kWordsPerBlock;
+    SetBlockBits(first_word + 0, _mm256_extract_epi64(mask, 0));
+    SetBlockBits(first_word + 1, _mm256_extract_epi64(mask, 1));
+    SetBlockBits(first_word + 2, _mm256_extract_epi64(mask, 2));
+    SetBlockBits(first_word + 3, _mm256_extract_epi64(mask, 3));
+  }
 
-int64_t BlockedBloomFilter::Insert_avx2(int64_t num_rows, const uint64_t* hashes) {
-    return InsertImp_avx2(num_rows, hashes);
+  return num_rows;
 }
 
 }  // namespace duckdb
\ No newline at end of file
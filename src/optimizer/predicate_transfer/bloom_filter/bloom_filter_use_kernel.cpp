@@ -1,30 +1,38 @@
 #include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter_use_kernel.hpp"
 #include "duckdb/common/types/vector.hpp"
-#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
-void BloomFilterUseKernel::filter(const vector<Vector> &result,
-            shared_ptr<BlockedBloomFilter> bloom_filter,
-            SelectionVector &sel,
-            idx_t &approved_tuple_count,
-            idx_t row_num) {
-    if (bloom_filter->isEmpty()) {
+void BloomFilterUseKernel::filter(const hash_t *hashes,
+            BlockedBloomFilter &bloom_filter,
+            const SelectionVector *sel,
+            idx_t count,
+            SelectionVector &result_sel,
+            idx_t &approved_tuple_count) {
+    if (bloom_filter.isEmpty()) {
         approved_tuple_count = 0;
         return;
     }
     idx_t result_count = 0;
-    Vector hashes(LogicalType::HASH);
-    VectorOperations::Hash(const_cast<Vector &>(result[bloom_filter->BoundColsApplied[0]]), hashes, row_num);
-    for (int i = 1; i < bloom_filter->BoundColsApplied.size(); i++) {
-	    VectorOperations::CombineHash(hashes, const_cast<Vector &>(result[bloom_filter->BoundColsApplied[i]]), row_num);
+    if (!sel) {
+        bloom_filter.Find(arrow::internal::CpuInfo::AVX2, count, hashes, result_sel, result_count, false);
+        approved_tuple_count = result_count;
+        return;
     }
-    if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-        hashes.Flatten(row_num);
+    // gather the hashes of the selected rows so that the batched probe can be used,
+    // and the rows themselves: Find overwrites sel when result_sel aliases it
+    hash_t dense_hashes[STANDARD_VECTOR_SIZE];
+    sel_t dense_rows[STANDARD_VECTOR_SIZE];
+    for (idx_t i = 0; i < count; i++) {
+        auto row = sel->get_index(i);
+        dense_hashes[i] = hashes[row];
+        dense_rows[i] = sel_t(row);
+    }
+    bloom_filter.Find(arrow::internal::CpuInfo::AVX2, count, dense_hashes, result_sel, result_count, false);
+    // translate positions in the gathered hashes back to row indices
+    for (idx_t i = 0; i < result_count; i++) {
+        result_sel.set_index(i, dense_rows[result_sel.get_index(i)]);
     }
-    bloom_filter->Find(arrow::internal::CpuInfo::AVX2, row_num, (hash_t*)hashes.GetData(), sel, result_count, false);
-
     approved_tuple_count = result_count;
-    return;
 }
 }
\ No newline at end of file
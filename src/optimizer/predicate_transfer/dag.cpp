@@ -26,11 +26,7 @@ namespace duckdb {
         return;
     }
 
-#ifdef UseHashFilter
-    void DAGNode::AddIn(idx_t from, shared_ptr<HashFilter> bloom_filter, bool forward) { 
-#else
-    void DAGNode::AddIn(idx_t from, shared_ptr<BlockedBloomFilter> bloom_filter, bool forward) {
-#endif
+    void DAGNode::AddIn(idx_t from, shared_ptr<TransferFilter> bloom_filter, bool forward) {
         if(forward) {
             for (auto &node : forward_in_) {
                 if(node->GetDest() == from) {
@@ -80,11 +76,7 @@ namespace duckdb {
         return;
     }
 
-#ifdef UseHashFilter
-    void DAGNode::AddOut(idx_t to, shared_ptr<HashFilter> bloom_filter, bool forward) {
-#else
-    void DAGNode::AddOut(idx_t to, shared_ptr<BlockedBloomFilter> bloom_filter, bool forward) {
-#endif
+    void DAGNode::AddOut(idx_t to, shared_ptr<TransferFilter> bloom_filter, bool forward) {
         if(forward) {
             for (auto &node : forward_out_) {
                 if(node->GetDest() == to) {
@@ -4,9 +4,10 @@
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/optimizer/predicate_transfer/predicate_transfer_optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 #include <queue>
 
-#include "duckdb/optimizer/predicate_transfer/setting.hpp"
+#include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
 
@@ -30,16 +31,51 @@ bool DAGManager::Build(LogicalOperator &plan) {
     return true;
 }
 
+static void CollectColumnRefs(Expression &expr, vector<BoundColumnRefExpression*> &colrefs) {
+    if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+        colrefs.emplace_back(&expr.Cast<BoundColumnRefExpression>());
+    } else {
+        ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CollectColumnRefs(child, colrefs); });
+    }
+}
+
+/* The relation whose columns a join key reads, false if it reads none or several */
+bool DAGManager::GetExpressionTable(Expression &expr, idx_t &table) {
+    if (expr.HasSideEffects() || expr.HasSubquery()) {
+        return false;
+    }
+    vector<BoundColumnRefExpression*> colrefs;
+    CollectColumnRefs(expr, colrefs);
+    if (colrefs.empty()) {
+        return false;
+    }
+    table = nodes_manager.FindRename(colrefs[0]->binding).table_index;
+    for (auto colref : colrefs) {
+        if (colref->depth != 0 || nodes_manager.FindRename(colref->binding).table_index != table) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Whether a join key reads a column that the filters of this join may not carry below a window */
+bool DAGManager::CrossesWindow(idx_t join_index, Expression &expr) {
+    vector<BoundColumnRefExpression*> colrefs;
+    CollectColumnRefs(expr, colrefs);
+    for (auto colref : colrefs) {
+        if (nodes_manager.CrossesWindow(join_index, colref->binding)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 vector<LogicalOperator*>& DAGManager::getExecOrder() {
     // The root as first
     return ExecOrder;
 }
 
-#ifdef UseHashFilter
-    void DAGManager::Add(idx_t create_table, shared_ptr<HashFilter> use_bf, bool reverse) {
-#else
-    void DAGManager::Add(idx_t create_table, shared_ptr<BlockedBloomFilter> use_bf, bool reverse) {
-#endif
+    void DAGManager::Add(idx_t create_table, shared_ptr<TransferFilter> use_bf, bool reverse) {
     if (!reverse) {
         auto in = use_bf->GetColApplied()[0].table_index;
         nodes.nodes[in]->AddIn(create_table, use_bf, true);
@@ -54,31 +90,27 @@ void DAGManager::ExtractEdges(LogicalOperator &op,
                               vector<reference<LogicalOperator>> &filter_operators) {
     auto &sorted_nodes = nodes_manager.getSortedNodes();
 	expression_set_t filter_set;
-    for (auto &filter_op : filter_operators) {
-		auto &f_op = filter_op.get();
+    for (idx_t join_index = 0; join_index < filter_operators.size(); join_index++) {
+		auto &f_op = filter_operators[join_index].get();
         if (f_op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN || f_op.type == LogicalOperatorType::LOGICAL_DELIM_JOIN) {
             auto &join = f_op.Cast<LogicalComparisonJoin>();
 			D_ASSERT(join.expressions.empty());
 			for (auto &cond : join.conditions) {
-                if(cond.comparison != ExpressionType::COMPARE_EQUAL) {
+                if(!NodesManager::IsTransferCondition(join.join_type, cond)
+                || CrossesWindow(join_index, *cond.left) || CrossesWindow(join_index, *cond.right)) {
                     continue;
                 }
 				auto comparison =
 				    make_uniq<BoundComparisonExpression>(cond.comparison, cond.left->Copy(), cond.right->Copy());
+                // Each side may be an expression, as long as it only reads the columns of one relation
+                idx_t left_table;
+                idx_t right_table;
+                if (!GetExpressionTable(*comparison->left, left_table) || !GetExpressionTable(*comparison->right, right_table)
+                || left_table == right_table) {
+                    continue;
+                }
 				if (filter_set.find(*comparison) == filter_set.end()) {
 					filter_set.insert(*comparison);
-					ColumnBinding left_binding;
-					if (comparison->left->type == ExpressionType::BOUND_COLUMN_REF) {
-		                auto &colref = comparison->left->Cast<BoundColumnRefExpression>();
-		                left_binding = colref.binding;
-	                }
-                    ColumnBinding right_binding;
-					if (comparison->right->type == ExpressionType::BOUND_COLUMN_REF) {
-		                auto &colref = comparison->right->Cast<BoundColumnRefExpression>();
-		                right_binding = colref.binding;
-	                }
-                    idx_t left_table = nodes_manager.FindRename(left_binding).table_index;
-                    idx_t right_table = nodes_manager.FindRename(right_binding).table_index;
                     auto left_node = nodes_manager.getNode(left_table);
                     if (left_node == nullptr) {
                         continue;
@@ -242,9 +274,10 @@ pair<int, int> DAGManager::FindEdgeRandom(unordered_set<int> &constructed_set,
     return result;
 }
 
-void DAGManager::LargestRoot(vector<LogicalOperator*> &sorted_nodes) {
-    unordered_set<int> constructed_set;
-    unordered_set<int> unconstructed_set;
+/* Create the vertices with the last of the sorted nodes as the root, which is the first relation of the
+ * execution order. Returns the priority of the next relation attached to the tree */
+int DAGManager::CreateRootedVertices(vector<LogicalOperator*> &sorted_nodes, unordered_set<int> &constructed_set,
+                                     unordered_set<int> &unconstructed_set) {
     int prior_flag = nodes_manager.NumNodes() - 1;
     int root = -1;
     // Create Vertices
@@ -265,23 +298,59 @@ void DAGManager::LargestRoot(vector<LogicalOperator*> &sorted_nodes) {
     // delete root
     ExecOrder.emplace_back(nodes_manager.getNode(root));
     nodes_manager.EraseNode(root);
+    return prior_flag;
+}
+
+/* Attach the new node of the edge (old node at first, new node at second) to the tree and select the edge's filters */
+void DAGManager::AttachNode(pair<int, int> &selected_edge, int &prior_flag, unordered_set<int> &constructed_set,
+                            unordered_set<int> &unconstructed_set) {
+    if(filters_and_bindings_.find(selected_edge) != filters_and_bindings_.end()) {
+        for(auto &v : filters_and_bindings_[selected_edge]) {
+            selected_filters_and_bindings_.emplace_back(std::move(v));
+        }
+    }
+    auto node = nodes.nodes[selected_edge.second].get();
+    node->priority = prior_flag--;
+    ExecOrder.emplace_back(nodes_manager.getNode(node->Id()));
+    nodes_manager.EraseNode(node->Id());
+    unconstructed_set.erase(selected_edge.second);
+    constructed_set.emplace(selected_edge.second);
+}
+
+void DAGManager::LargestRoot(vector<LogicalOperator*> &sorted_nodes) {
+    unordered_set<int> constructed_set;
+    unordered_set<int> unconstructed_set;
+    int prior_flag = CreateRootedVertices(sorted_nodes, constructed_set, unconstructed_set);
     while(!unconstructed_set.empty()) {
         // Old node at first, new add node at second
         auto selected_edge = FindEdge(constructed_set, unconstructed_set);
         if(selected_edge.first == -1 && selected_edge.second == -1) {
            break;
         }
-        if(filters_and_bindings_.find(selected_edge) != filters_and_bindings_.end()) {
-            for(auto &v : filters_and_bindings_[selected_edge]) {
-                selected_filters_and_bindings_.emplace_back(std::move(v));
+        AttachNode(selected_edge, prior_flag, constructed_set, unconstructed_set);
+    }
+}
+
+/* Like LargestRoot, but the tree grows breadth-first from the root: a relation is attached to the shallowest
+ * relation it joins with. The forward and backward passes are then only as long as the tree is deep, and the
+ * subtrees hanging off one level build and apply their filters in independent pipelines */
+void DAGManager::BushyRoot(vector<LogicalOperator*> &sorted_nodes) {
+    unordered_set<int> constructed_set;
+    unordered_set<int> unconstructed_set;
+    int prior_flag = CreateRootedVertices(sorted_nodes, constructed_set, unconstructed_set);
+    unordered_set<int> level = constructed_set;
+    while(!level.empty() && !unconstructed_set.empty()) {
+        unordered_set<int> next_level;
+        while(true) {
+            // Only relations of the current level can take children
+            auto selected_edge = FindEdge(level, unconstructed_set);
+            if(selected_edge.first == -1 && selected_edge.second == -1) {
+                break;
             }
+            AttachNode(selected_edge, prior_flag, constructed_set, unconstructed_set);
+            next_level.emplace(selected_edge.second);
         }
-        auto node = nodes.nodes[selected_edge.second].get();
-        node->priority = prior_flag--;
-        ExecOrder.emplace_back(nodes_manager.getNode(node->Id()));
-        nodes_manager.EraseNode(node->Id());
-        unconstructed_set.erase(selected_edge.second);
-        constructed_set.emplace(selected_edge.second);
+        level = std::move(next_level);
     }
 }
 
@@ -359,24 +428,29 @@ void DAGManager::RandomRoot(vector<LogicalOperator*> &sorted_nodes) {
 }
 
 void DAGManager::CreateDAG() {
-#ifdef SmalltoLarge
-    auto &sorted_nodes = nodes_manager.getSortedNodes();
-    Small2Large(sorted_nodes);
-#else
-    while(nodes_manager.getNodes().size() > 0) {
+    if (ClientConfig::GetConfig(context).transfer_order_strategy == TransferOrderStrategy::SMALL_TO_LARGE) {
         auto &sorted_nodes = nodes_manager.getSortedNodes();
-        LargestRoot(sorted_nodes);
-        // RandomRoot(sorted_nodes);
-        nodes_manager.ReSortNodes();
+        Small2Large(sorted_nodes);
+    } else {
+        while(nodes_manager.getNodes().size() > 0) {
+            auto &sorted_nodes = nodes_manager.getSortedNodes();
+            if (ClientConfig::GetConfig(context).transfer_order_strategy == TransferOrderStrategy::BUSHY) {
+                BushyRoot(sorted_nodes);
+            } else {
+                LargestRoot(sorted_nodes);
+            }
+            // RandomRoot(sorted_nodes);
+            nodes_manager.ReSortNodes();
+        }
+        nodes_manager.RecoverNodes();
     }
-    nodes_manager.RecoverNodes();
-#endif
     for (auto &filter_and_binding : selected_filters_and_bindings_) {
         if(filter_and_binding) {
             idx_t large;
             switch(filter_and_binding->large_.type) {
                 case LogicalOperatorType::LOGICAL_GET:
                 case LogicalOperatorType::LOGICAL_DELIM_GET:
+                case LogicalOperatorType::LOGICAL_CTE_REF:
                 case LogicalOperatorType::LOGICAL_PROJECTION:
                 case LogicalOperatorType::LOGICAL_UNION:
 		        case LogicalOperatorType::LOGICAL_EXCEPT:
@@ -400,6 +474,7 @@ void DAGManager::CreateDAG() {
             switch(filter_and_binding->small_.type) {
                 case LogicalOperatorType::LOGICAL_GET:
                 case LogicalOperatorType::LOGICAL_DELIM_GET:
+                case LogicalOperatorType::LOGICAL_CTE_REF:
                 case LogicalOperatorType::LOGICAL_PROJECTION:
                 case LogicalOperatorType::LOGICAL_UNION:
 		        case LogicalOperatorType::LOGICAL_EXCEPT:
@@ -463,6 +538,7 @@ vector<DAGNode*> DAGManager::GetNeighbors(idx_t node_id) {
                 switch(op.type) {
                     case LogicalOperatorType::LOGICAL_GET:
                     case LogicalOperatorType::LOGICAL_DELIM_GET:
+                    case LogicalOperatorType::LOGICAL_CTE_REF:
                     case LogicalOperatorType::LOGICAL_PROJECTION:
                     case LogicalOperatorType::LOGICAL_UNION:
 	                case LogicalOperatorType::LOGICAL_EXCEPT:
@@ -489,6 +565,7 @@ vector<DAGNode*> DAGManager::GetNeighbors(idx_t node_id) {
                 switch(op.type) {
                     case LogicalOperatorType::LOGICAL_GET:
                     case LogicalOperatorType::LOGICAL_DELIM_GET:
+                    case LogicalOperatorType::LOGICAL_CTE_REF:
                     case LogicalOperatorType::LOGICAL_PROJECTION:
                     case LogicalOperatorType::LOGICAL_UNION:
 	                case LogicalOperatorType::LOGICAL_EXCEPT:
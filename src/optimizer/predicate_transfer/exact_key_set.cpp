@@ -0,0 +1,189 @@
+#include "duckdb/optimizer/predicate_transfer/exact_key_set.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+ExactKeySet::ExactKeySet(Kind kind, int64_t min, idx_t range)
+  : kind_(kind), min_(min), range_(range) {
+  if (kind_ == Kind::BITMAP) {
+    bits_ = make_unsafe_uniq_array<atomic<uint64_t>>((range_ + 63) / 64);
+  }
+}
+
+bool ExactKeySet::SupportsType(const LogicalType &type) {
+  switch (type.InternalType()) {
+    case PhysicalType::INT8:
+    case PhysicalType::INT16:
+    case PhysicalType::INT32:
+    case PhysicalType::INT64:
+    case PhysicalType::UINT8:
+    case PhysicalType::UINT16:
+    case PhysicalType::UINT32:
+      return true;
+    default:
+      return false;
+  }
+}
+
+unique_ptr<ExactKeySet> ExactKeySet::Choose(int64_t min, int64_t max, idx_t num_distinct) {
+  if (max < min) {
+    return nullptr;
+  }
+  num_distinct = MaxValue<idx_t>(num_distinct, 1);
+  // computed unsigned, the range of two int64_t keys does not fit an int64_t
+  idx_t range = uint64_t(max) - uint64_t(min);
+  if (range < kMaxBitmapBits && range < kMaxBitmapBitsPerKey * num_distinct) {
+    return unique_ptr<ExactKeySet>(new ExactKeySet(Kind::BITMAP, min, range + 1));
+  }
+  if (num_distinct <= kMaxSortedKeys) {
+    return unique_ptr<ExactKeySet>(new ExactKeySet(Kind::SORTED_ARRAY, min, range + 1));
+  }
+  return nullptr;
+}
+
+template <class T>
+void ExactKeySet::TemplatedInsert(Vector &keys, idx_t count) {
+  UnifiedVectorFormat vdata;
+  keys.ToUnifiedFormat(count, vdata);
+  auto data = UnifiedVectorFormat::GetData<T>(vdata);
+  if (kind_ == Kind::BITMAP) {
+    for (idx_t i = 0; i < count; i++) {
+      auto idx = vdata.sel->get_index(i);
+      if (!vdata.validity.RowIsValid(idx)) {
+        continue;
+      }
+      auto offset = uint64_t(int64_t(data[idx])) - uint64_t(min_);
+      if (offset < range_) {
+        bits_[offset / 64].fetch_or(uint64_t(1) << (offset % 64), std::memory_order_relaxed);
+      }
+    }
+    return;
+  }
+  // dedup the chunk first, so that the lock is held for a merge of two short sorted runs
+  vector<int64_t> chunk_keys;
+  chunk_keys.reserve(count);
+  for (idx_t i = 0; i < count; i++) {
+    auto idx = vdata.sel->get_index(i);
+    if (vdata.validity.RowIsValid(idx)) {
+      chunk_keys.push_back(int64_t(data[idx]));
+    }
+  }
+  std::sort(chunk_keys.begin(), chunk_keys.end());
+  chunk_keys.erase(std::unique(chunk_keys.begin(), chunk_keys.end()), chunk_keys.end());
+  if (chunk_keys.empty()) {
+    return;
+  }
+  lock_guard<mutex> guard(keys_lock_);
+  vector<int64_t> merged;
+  merged.reserve(keys_.size() + chunk_keys.size());
+  std::set_union(keys_.begin(), keys_.end(), chunk_keys.begin(), chunk_keys.end(), std::back_inserter(merged));
+  keys_ = std::move(merged);
+}
+
+void ExactKeySet::Insert(Vector &keys, idx_t count) {
+  switch (keys.GetType().InternalType()) {
+    case PhysicalType::INT8:
+      TemplatedInsert<int8_t>(keys, count);
+      break;
+    case PhysicalType::INT16:
+      TemplatedInsert<int16_t>(keys, count);
+      break;
+    case PhysicalType::INT32:
+      TemplatedInsert<int32_t>(keys, count);
+      break;
+    case PhysicalType::INT64:
+      TemplatedInsert<int64_t>(keys, count);
+      break;
+    case PhysicalType::UINT8:
+      TemplatedInsert<uint8_t>(keys, count);
+      break;
+    case PhysicalType::UINT16:
+      TemplatedInsert<uint16_t>(keys, count);
+      break;
+    case PhysicalType::UINT32:
+      TemplatedInsert<uint32_t>(keys, count);
+      break;
+    default:
+      throw InternalException("ExactKeySet: unsupported key type");
+  }
+}
+
+void ExactKeySet::Finalize() {
+  if (kind_ == Kind::SORTED_ARRAY) {
+    empty_ = keys_.empty();
+    return;
+  }
+  empty_ = true;
+  for (idx_t i = 0; i < (range_ + 63) / 64; i++) {
+    if (bits_[i].load(std::memory_order_relaxed) != 0) {
+      empty_ = false;
+      break;
+    }
+  }
+}
+
+inline bool ExactKeySet::Contains(int64_t key) const {
+  if (kind_ == Kind::BITMAP) {
+    auto offset = uint64_t(key) - uint64_t(min_);
+    return offset < range_ && (bits_[offset / 64].load(std::memory_order_relaxed) >> (offset % 64)) & 1;
+  }
+  return std::binary_search(keys_.begin(), keys_.end(), key);
+}
+
+template <class T>
+void ExactKeySet::TemplatedSelect(Vector &keys, const SelectionVector *sel, idx_t count,
+                                  SelectionVector &result, idx_t &result_count) const {
+  UnifiedVectorFormat vdata;
+  keys.ToUnifiedFormat(count, vdata);
+  auto data = UnifiedVectorFormat::GetData<T>(vdata);
+  idx_t found = 0;
+  for (idx_t i = 0; i < count; i++) {
+    auto row = sel ? sel->get_index(i) : i;
+    auto idx = vdata.sel->get_index(row);
+    // NULL keys never join; result[found] is written after sel[i] is read, found <= i
+    if (vdata.validity.RowIsValid(idx) && Contains(int64_t(data[idx]))) {
+      result.set_index(found++, row);
+    }
+  }
+  result_count = found;
+}
+
+void ExactKeySet::Select(Vector &keys, const SelectionVector *sel, idx_t count,
+                         SelectionVector &result, idx_t &result_count) const {
+  if (empty_) {
+    result_count = 0;
+    return;
+  }
+  switch (keys.GetType().InternalType()) {
+    case PhysicalType::INT8:
+      TemplatedSelect<int8_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::INT16:
+      TemplatedSelect<int16_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::INT32:
+      TemplatedSelect<int32_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::INT64:
+      TemplatedSelect<int64_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::UINT8:
+      TemplatedSelect<uint8_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::UINT16:
+      TemplatedSelect<uint16_t>(keys, sel, count, result, result_count);
+      break;
+    case PhysicalType::UINT32:
+      TemplatedSelect<uint32_t>(keys, sel, count, result, result_count);
+      break;
+    default:
+      // a probe key of another type than the build keys: let every row pass
+      for (idx_t i = 0; i < count; i++) {
+        result.set_index(i, sel ? sel->get_index(i) : i);
+      }
+      result_count = count;
+      break;
+  }
+}
+}
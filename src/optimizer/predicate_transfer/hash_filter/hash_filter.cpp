@@ -8,7 +8,6 @@
 #include "duckdb/common/types/row/partitioned_tuple_data.hpp"
 #include <iostream>
 
-#ifdef UseHashFilter
 namespace duckdb {
 arrow::Status HashFilter::CreateEmpty(BufferManager* buffer, vector<LogicalType> layouts) {
   hash_table = make_shared<HashTable>(*buffer, layouts);
@@ -46,7 +45,7 @@ arrow::Status HashFilterBuilder_SingleThreaded::PushNextBatch(size_t /*thread_in
   return arrow::Status::OK();
 }
 
-vector<idx_t> HashFilterBuilder_SingleThreaded::BuiltCols() {
+const vector<idx_t> &HashFilterBuilder_SingleThreaded::BuiltCols() const {
   return build_target_->BoundColsBuilt;
 }
 
@@ -78,7 +77,7 @@ arrow::Status HashFilterBuilder_Parallel::PushNextBatch(size_t thread_id, int64_
   return arrow::Status::OK();
 }
 
-vector<idx_t> HashFilterBuilder_Parallel::BuiltCols() {
+const vector<idx_t> &HashFilterBuilder_Parallel::BuiltCols() const {
   return build_target_->BoundColsBuilt;
 }
 
@@ -91,5 +90,4 @@ void HashFilterBuilder_Parallel::CleanUp() {
 
 void HashFilterBuilder_Parallel::Merge() {
 }
-}
-#endif
\ No newline at end of file
+}
\ No newline at end of file
@@ -2,29 +2,51 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 
-#ifdef UseHashFilter
 namespace duckdb {
 
 void HashFilterUseKernel::filter(vector<Vector> &input,
-            shared_ptr<HashFilter> hash_filter,
-            SelectionVector &sel,
-            idx_t &approved_tuple_count,
-            idx_t row_num) {
-    if (hash_filter->isEmpty()) {
+            HashFilter &hash_filter,
+            const SelectionVector *sel,
+            idx_t count,
+            SelectionVector &result_sel,
+            idx_t &approved_tuple_count) {
+    DataChunk chunk;
+    for(int i = 0; i < hash_filter.BoundColsApplied.size(); i++) {
+        Vector v = input[hash_filter.BoundColsApplied[i]];
+        chunk.data.emplace_back(v);
+    }
+    filter(chunk, hash_filter, sel, count, result_sel, approved_tuple_count);
+}
+
+void HashFilterUseKernel::filter(DataChunk &chunk,
+            HashFilter &hash_filter,
+            const SelectionVector *sel,
+            idx_t count,
+            SelectionVector &result_sel,
+            idx_t &approved_tuple_count) {
+    if (hash_filter.isEmpty()) {
         approved_tuple_count = 0;
         return;
     }
     idx_t result_count = 0;
-    DataChunk chunk;
-    chunk.SetCardinality(row_num);
-    for(int i = 0; i < hash_filter->BoundColsApplied.size(); i++) {
-        Vector v = input[hash_filter->BoundColsApplied[i]];
-        chunk.data.emplace_back(v);
+    chunk.SetCardinality(count);
+    // the sliced keys keep reading the selection while the probe writes result_sel,
+    // so they get their own copy in case the two alias
+    SelectionVector key_sel;
+    if (sel) {
+        key_sel.Initialize(count);
+        for (idx_t i = 0; i < count; i++) {
+            key_sel.set_index(i, sel->get_index(i));
+        }
+        chunk.Slice(key_sel, count);
+    }
+    hash_filter.Find(arrow::internal::CpuInfo::AVX2, count, chunk, result_sel, result_count, false);
+    if (sel) {
+        // the probe reports positions within the sliced keys
+        for (idx_t i = 0; i < result_count; i++) {
+            result_sel.set_index(i, key_sel.get_index(result_sel.get_index(i)));
+        }
     }
-    hash_filter->Find(arrow::internal::CpuInfo::AVX2, row_num, chunk, sel, result_count, false);
-
     approved_tuple_count = result_count;
-    return;
-}
 }
-#endif
\ No newline at end of file
+}
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "duckdb/planner/operator/logical_window.hpp"
 #include "duckdb/optimizer/predicate_transfer/predicate_transfer_optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
 #include <pthread.h>
 
 namespace duckdb {
@@ -47,6 +49,7 @@ void NodesManager::AddNode(LogicalOperator *op) {
 	switch(op->type) {
 		case LogicalOperatorType::LOGICAL_GET:
 		case LogicalOperatorType::LOGICAL_DELIM_GET:
+		case LogicalOperatorType::LOGICAL_CTE_REF:
 		case LogicalOperatorType::LOGICAL_PROJECTION:
 		case LogicalOperatorType::LOGICAL_UNION:
 		case LogicalOperatorType::LOGICAL_EXCEPT:
@@ -113,6 +116,21 @@ void NodesManager::EraseNode(idx_t key) {
 
 bool can_add_mark = true;
 
+/* Equalities transfer for every supported join type, inequalities only bound the keys of inner joins */
+bool NodesManager::IsTransferCondition(JoinType join_type, const JoinCondition &cond) {
+	switch (cond.comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return true;
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return join_type == JoinType::INNER;
+	default:
+		return false;
+	}
+}
+
 /* Extract All the vertex nodes */
 void NodesManager::ExtractNodes(LogicalOperator &plan, vector<reference<LogicalOperator>> &filter_operators) {
     LogicalOperator *op = &plan;
@@ -148,18 +166,14 @@ void NodesManager::ExtractNodes(LogicalOperator &plan, vector<reference<LogicalO
 		|| join.join_type == JoinType::SEMI
 		|| join.join_type == JoinType::RIGHT_SEMI) {
 			for(auto &jc : join.conditions) {
-				if(jc.comparison == ExpressionType::COMPARE_EQUAL
-				&& jc.left->type == ExpressionType::BOUND_COLUMN_REF
-				&& jc.right->type == ExpressionType::BOUND_COLUMN_REF) {
+				if(IsTransferCondition(join.join_type, jc)) {
 					filter_operators.push_back(*op);
 					break;
 				}
 			}
 		} else if (join.join_type == JoinType::MARK && can_add_mark) {
 			for(auto &jc : join.conditions) {
-				if(jc.comparison == ExpressionType::COMPARE_EQUAL
-				&& jc.left->type == ExpressionType::BOUND_COLUMN_REF
-				&& jc.right->type == ExpressionType::BOUND_COLUMN_REF) {
+				if(IsTransferCondition(join.join_type, jc)) {
 					filter_operators.push_back(*op);
 					break;
 				}
@@ -192,8 +206,30 @@ void NodesManager::ExtractNodes(LogicalOperator &plan, vector<reference<LogicalO
 		return;
 	}
 	case LogicalOperatorType::LOGICAL_WINDOW: {
-		// optimize children
-		AddNode(op);
+		// Rows removed below a window change what its functions compute, unless every function is evaluated per
+		// partition of the key. Only the partition columns shared by all window functions pass the filters of the
+		// joins above
+		auto &window = op->Cast<LogicalWindow>();
+		column_binding_set_t partition_cols;
+		for (idx_t i = 0; i < window.expressions.size(); i++) {
+			column_binding_set_t expr_partition_cols;
+			if (window.expressions[i]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW) {
+				for (auto &partition : window.expressions[i]->Cast<BoundWindowExpression>().partitions) {
+					if (partition->type == ExpressionType::BOUND_COLUMN_REF) {
+						auto &binding = partition->Cast<BoundColumnRefExpression>().binding;
+						if (i == 0 || partition_cols.find(binding) != partition_cols.end()) {
+							expr_partition_cols.insert(binding);
+						}
+					}
+				}
+			}
+			partition_cols = std::move(expr_partition_cols);
+		}
+		for (auto &binding : op->children[0]->GetColumnBindings()) {
+			if (partition_cols.find(binding) == partition_cols.end() && window_barriers.find(binding) == window_barriers.end()) {
+				window_barriers[binding] = filter_operators.size();
+			}
+		}
 		ExtractNodes(*op->children[0], filter_operators);
 		return;
 	}
@@ -221,7 +257,8 @@ void NodesManager::ExtractNodes(LogicalOperator &plan, vector<reference<LogicalO
 		AddNode(op);
 		return;
 	}
-	case LogicalOperatorType::LOGICAL_DELIM_GET: {
+	case LogicalOperatorType::LOGICAL_DELIM_GET:
+	case LogicalOperatorType::LOGICAL_CTE_REF: {
 		AddNode(op);
 		return;
 	}
@@ -256,6 +293,20 @@ void NodesManager::ExtractNodes(LogicalOperator &plan, vector<reference<LogicalO
 	}
 }
 
+bool NodesManager::CrossesWindow(idx_t join_index, ColumnBinding col) {
+	for (auto cur = col;;) {
+		auto barrier = window_barriers.find(cur);
+		if (barrier != window_barriers.end() && join_index < barrier->second) {
+			return true;
+		}
+		auto next = rename_cols.find(cur);
+		if (next == rename_cols.end()) {
+			return false;
+		}
+		cur = next->second;
+	}
+}
+
 int NodesManager::nodesCmp(LogicalOperator *a, LogicalOperator *b) {
     return a->estimated_cardinality < b->estimated_cardinality;
 }
@@ -18,7 +18,10 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/optimizer/predicate_transfer/range_filter.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include <set>
 
 namespace duckdb {
@@ -96,29 +99,23 @@ void PredicateTransferOptimizer::GetColumnBindingExpression(Expression &expr, ve
 }
 
 /* Create Bloom filter and use existing Bloom filter for the given scan or filter node */
-#ifdef UseHashFilter
-vector<pair<idx_t, shared_ptr<HashFilter>>> PredicateTransferOptimizer::CreateBloomFilter(LogicalOperator &node, bool reverse) {
-	vector<pair<idx_t, shared_ptr<HashFilter>>> result;
-	vector<shared_ptr<HashFilter>> temp_result_to_use;
-	vector<shared_ptr<HashFilter>> temp_result_to_create;
-#else
-vector<pair<idx_t, shared_ptr<BlockedBloomFilter>>> PredicateTransferOptimizer::CreateBloomFilter(LogicalOperator &node, bool reverse) {
-	vector<pair<idx_t, shared_ptr<BlockedBloomFilter>>> result;
-	vector<shared_ptr<BlockedBloomFilter>> temp_result_to_use;
-	vector<shared_ptr<BlockedBloomFilter>> temp_result_to_create;
-#endif
+vector<pair<idx_t, shared_ptr<TransferFilter>>> PredicateTransferOptimizer::CreateBloomFilter(LogicalOperator &node, bool reverse) {
+	vector<pair<idx_t, shared_ptr<TransferFilter>>> result;
+	vector<shared_ptr<TransferFilter>> temp_result_to_use;
+	vector<shared_ptr<TransferFilter>> temp_result_to_create;
 	idx_t cur = GetNodeId(node);
 	if(dag_manager.nodes.nodes.find(cur) == dag_manager.nodes.nodes.end()) {
 		return result;
 	}
 	// Use Bloom Filter
-	#ifdef UseHashFilter
-	std::cout << "In CreateBloomFilter UseHashFilter" << std::endl;
-	#else
-	std::cout << "In CreateBloomFilter UseBloomFilter" << std::endl;
-	#endif
+	if (ClientConfig::GetConfig(context).transfer_filter_type == TransferFilterType::HASH_FILTER) {
+		std::cout << "In CreateBloomFilter UseHashFilter" << std::endl;
+	} else {
+		std::cout << "In CreateBloomFilter UseBloomFilter" << std::endl;
+	}
 	vector<idx_t> depend_nodes;
 	GetAllBFUsed(cur, temp_result_to_use, depend_nodes, reverse);
+	cost_model.ApplyFilters(cur, temp_result_to_use);
 	std::cout << "GetAllBFUsed: " << temp_result_to_use.size() << std::endl;
 	std::cout << "GetAllBFUsed: " << depend_nodes.size() << std::endl;
 	for (auto &id : depend_nodes) {
@@ -131,9 +128,6 @@ vector<pair<idx_t, shared_ptr<BlockedBloomFilter>>> PredicateTransferOptimizer::
 		if(temp_result_to_create.size() == 0) {
 			return result;
 		} else {
-			if(!PossibleFilterAny(node, reverse)) {
-				return result;
-			}
 			auto create_bf = BuildSingleCreateOperator(node, temp_result_to_create);
 			for (auto &filter : create_bf->bf_to_create) {
 				result.emplace_back(make_pair(cur, filter));
@@ -174,6 +168,7 @@ idx_t PredicateTransferOptimizer::GetNodeId(LogicalOperator &node) {
 	switch(node.type) {
 		case LogicalOperatorType::LOGICAL_GET:
 		case LogicalOperatorType::LOGICAL_DELIM_GET:
+		case LogicalOperatorType::LOGICAL_CTE_REF:
 		case LogicalOperatorType::LOGICAL_PROJECTION:
 		case LogicalOperatorType::LOGICAL_UNION:
 		case LogicalOperatorType::LOGICAL_EXCEPT:
@@ -196,11 +191,7 @@ idx_t PredicateTransferOptimizer::GetNodeId(LogicalOperator &node) {
 	return res;
 }
 
-#ifdef UseHashFilter
-void PredicateTransferOptimizer::GetAllBFUsed(idx_t cur, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
-#else
-void PredicateTransferOptimizer::GetAllBFUsed(idx_t cur, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
-#endif
+void PredicateTransferOptimizer::GetAllBFUsed(idx_t cur, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
 	if(!reverse) {
 		for(auto &edge : dag_manager.nodes.nodes[cur]->forward_in_) {
 			for(auto bloom_filter : edge->bloom_filters) {
@@ -225,124 +216,159 @@ void PredicateTransferOptimizer::GetAllBFUsed(idx_t cur, vector<shared_ptr<Block
 	}
 }
 
-#ifdef UseHashFilter
-void PredicateTransferOptimizer::GetAllBFCreate(idx_t cur, vector<shared_ptr<HashFilter>> &temp_result_to_create, bool reverse) {
-#else
-void PredicateTransferOptimizer::GetAllBFCreate(idx_t cur, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create, bool reverse) {
-#endif
-	if (!reverse) {
-		for(auto &edge : dag_manager.nodes.nodes[cur]->forward_out_) {
-#ifdef UseHashFilter
-			auto cur_filter = make_shared<HashFilter>();
-#else
-			auto cur_filter = make_shared<BlockedBloomFilter>();
-#endif
-			// Each Expression leads to a bloom filter on a column on this table
-			for (auto &expr : edge->filters) {
-				vector<BoundColumnRefExpression*> expressions;
-				GetColumnBindingExpression(*expr, expressions);
-				if (dag_manager.nodes_manager.FindRename(expressions[0]->binding).table_index == cur) {
-					cur_filter->AddColumnBindingApplied(dag_manager.nodes_manager.FindRename(expressions[1]->binding));
-					cur_filter->AddColumnBindingBuilt(dag_manager.nodes_manager.FindRename(expressions[0]->binding));
-				} else if (dag_manager.nodes_manager.FindRename(expressions[1]->binding).table_index == cur) {
-					cur_filter->AddColumnBindingApplied(dag_manager.nodes_manager.FindRename(expressions[0]->binding));
-					cur_filter->AddColumnBindingBuilt(dag_manager.nodes_manager.FindRename(expressions[1]->binding));
-				}
+/* The filter kind is chosen per query by the predicate_transfer_filter setting */
+shared_ptr<TransferFilter> PredicateTransferOptimizer::MakeTransferFilter() {
+	switch (ClientConfig::GetConfig(context).transfer_filter_type) {
+	case TransferFilterType::HASH_FILTER:
+		return make_shared<HashFilter>();
+	default: {
+		auto bloom_filter = make_shared<BlockedBloomFilter>();
+		bloom_filter->SetFalsePositiveRate(ClientConfig::GetConfig(context).transfer_false_positive_rate);
+		bloom_filter->SetPrefetchDistance(ClientConfig::GetConfig(context).transfer_prefetch_distance);
+		bloom_filter->SetLayout(ClientConfig::GetConfig(context).transfer_bloom_layout);
+		return bloom_filter;
+	}
+	}
+}
+
+/* The relation a join key reads, after following projections and aggregates */
+idx_t PredicateTransferOptimizer::GetKeyTable(Expression &key) {
+	vector<BoundColumnRefExpression*> expressions;
+	GetColumnBindingExpression(key, expressions);
+	D_ASSERT(!expressions.empty());
+	return dag_manager.nodes_manager.FindRename(expressions[0]->binding).table_index;
+}
+
+/* A copy of the join key that reads the columns of the relation it is evaluated on */
+unique_ptr<Expression> PredicateTransferOptimizer::RenameKey(Expression &key) {
+	auto result = key.Copy();
+	vector<BoundColumnRefExpression*> expressions;
+	GetColumnBindingExpression(*result, expressions);
+	for (auto colref : expressions) {
+		colref->binding = dag_manager.nodes_manager.FindRename(colref->binding);
+	}
+	return result;
+}
+
+/* Plain column keys are bound by column, a side with any other expression keeps all its keys as expressions */
+void PredicateTransferOptimizer::AddFilterKeys(TransferFilter &filter, vector<unique_ptr<Expression>> &keys_built, vector<unique_ptr<Expression>> &keys_applied) {
+	auto is_column = [](unique_ptr<Expression> &key) { return key->type == ExpressionType::BOUND_COLUMN_REF; };
+	bool built_columns = std::all_of(keys_built.begin(), keys_built.end(), is_column);
+	bool applied_columns = std::all_of(keys_applied.begin(), keys_applied.end(), is_column);
+	for (idx_t i = 0; i < keys_built.size(); i++) {
+		vector<BoundColumnRefExpression*> built;
+		GetColumnBindingExpression(*keys_built[i], built);
+		vector<BoundColumnRefExpression*> applied;
+		GetColumnBindingExpression(*keys_applied[i], applied);
+		// expression keys are still represented by the first column they read, which decides the edge they belong to
+		filter.AddColumnBindingBuilt(built[0]->binding);
+		filter.AddColumnBindingApplied(applied[0]->binding);
+		if (!built_columns) {
+			filter.AddExpressionBuilt(std::move(keys_built[i]));
+		}
+		if (!applied_columns) {
+			filter.AddExpressionApplied(std::move(keys_applied[i]));
+		}
+	}
+}
+
+void PredicateTransferOptimizer::GetAllBFCreate(idx_t cur, vector<shared_ptr<TransferFilter>> &temp_result_to_create, bool reverse) {
+	auto &out_edges = !reverse ? dag_manager.nodes.nodes[cur]->forward_out_ : dag_manager.nodes.nodes[cur]->backward_out_;
+	for (auto &edge : out_edges) {
+		auto dest = edge->GetDest();
+		// The equalities of an edge share one filter, each inequality bounds the applied keys on its own
+		vector<unique_ptr<Expression>> keys_built;
+		vector<unique_ptr<Expression>> keys_applied;
+		vector<shared_ptr<TransferFilter>> edge_filters;
+		for (auto &expr : edge->filters) {
+			auto &comparison = expr->Cast<BoundComparisonExpression>();
+			unique_ptr<Expression> built;
+			unique_ptr<Expression> applied;
+			// how the applied key compares to the built key
+			ExpressionType applied_comparison;
+			if (GetKeyTable(*comparison.left) == cur) {
+				built = RenameKey(*comparison.left);
+				applied = RenameKey(*comparison.right);
+				applied_comparison = FlipComparisonExpression(comparison.type);
+			} else if (GetKeyTable(*comparison.right) == cur) {
+				built = RenameKey(*comparison.right);
+				applied = RenameKey(*comparison.left);
+				applied_comparison = comparison.type;
+			} else {
+				continue;
 			}
-			if (cur_filter->column_bindings_built_.size() != 0) {
-				temp_result_to_create.emplace_back(cur_filter);
+			if (applied_comparison == ExpressionType::COMPARE_EQUAL) {
+				keys_built.emplace_back(std::move(built));
+				keys_applied.emplace_back(std::move(applied));
 			} else {
-				throw InternalException("No colmun binding found!");
+				auto range_filter = make_shared<RangeFilter>(applied_comparison);
+				vector<unique_ptr<Expression>> range_built;
+				range_built.emplace_back(std::move(built));
+				vector<unique_ptr<Expression>> range_applied;
+				range_applied.emplace_back(std::move(applied));
+				AddFilterKeys(*range_filter, range_built, range_applied);
+				edge_filters.emplace_back(std::move(range_filter));
 			}
 		}
-	} else {
-		for(auto &edge : dag_manager.nodes.nodes[cur]->backward_out_) {
-#ifdef UseHashFilter
-			auto cur_filter = make_shared<HashFilter>();
-#else
-			auto cur_filter = make_shared<BlockedBloomFilter>();
-#endif
-			// Each Expression leads to a bloom filter on a column on this table
-			for (auto &expr : edge->filters) {
-				vector<BoundColumnRefExpression*> expressions;
-				GetColumnBindingExpression(*expr, expressions);
-				D_ASSERT(expressions.size() == 2);
-				if (dag_manager.nodes_manager.FindRename(expressions[0]->binding).table_index == cur) {
-					cur_filter->AddColumnBindingApplied(dag_manager.nodes_manager.FindRename(expressions[1]->binding));
-					cur_filter->AddColumnBindingBuilt(dag_manager.nodes_manager.FindRename(expressions[0]->binding));
-				} else if (dag_manager.nodes_manager.FindRename(expressions[1]->binding).table_index == cur) {
-					cur_filter->AddColumnBindingApplied(dag_manager.nodes_manager.FindRename(expressions[0]->binding));
-					cur_filter->AddColumnBindingBuilt(dag_manager.nodes_manager.FindRename(expressions[1]->binding));
-				}
-			}
-			if (cur_filter->column_bindings_built_.size() != 0) {
-				temp_result_to_create.emplace_back(cur_filter);
-			} else {
-				throw InternalException("No built colmun found!");
+		if (!keys_built.empty()) {
+			auto cur_filter = MakeTransferFilter();
+			AddFilterKeys(*cur_filter, keys_built, keys_applied);
+			edge_filters.insert(edge_filters.begin(), std::move(cur_filter));
+		}
+		if (edge_filters.empty()) {
+			throw InternalException("No colmun binding found!");
+		}
+		for (auto &filter : edge_filters) {
+			filter->SetProbeCardinality(dag_manager.nodes.nodes[dest]->size);
+			// Leave out filters that are not expected to pay for themselves
+			if (cost_model.IsBeneficial(cur, dest, *filter)) {
+				temp_result_to_create.emplace_back(filter);
 			}
 		}
 	}
 }
 
-#ifdef UseHashFilter
-unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_create) {
-#else
-unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create) {
-#endif
+unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildSingleCreateOperator(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_create) {
 	auto create_bf = make_uniq<LogicalCreateBF>(temp_result_to_create);
 	create_bf->has_estimated_cardinality = true;
 	create_bf->estimated_cardinality = node.estimated_cardinality;
 	return create_bf;
 }
 
-#ifdef UseHashFilter
-unique_ptr<LogicalUseBF> PredicateTransferOptimizer::BuildUseOperator(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
-#else
-unique_ptr<LogicalUseBF> PredicateTransferOptimizer::BuildUseOperator(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
-#endif
-	unique_ptr<LogicalUseBF> pre_use_bf;
-	unique_ptr<LogicalUseBF> use_bf;
+unique_ptr<LogicalUseBF> PredicateTransferOptimizer::BuildUseOperator(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<idx_t> &depend_nodes, bool reverse) {
+	// All incoming filters are probed by a single operator, one after another on the surviving rows
+	vector<shared_ptr<TransferFilter>> filters;
+	vector<LogicalCreateBF*> related_create_bfs;
 	// This is important for performance, not use (int i = 0; i < temp_result_to_use.size(); i++)
 	for (int i = temp_result_to_use.size() - 1; i >= 0; i--) {
-#ifdef UseHashFilter
-		vector<shared_ptr<HashFilter>> v;
-#else
-		vector<shared_ptr<BlockedBloomFilter>> v;
-#endif
-		v.emplace_back(temp_result_to_use[i]);
-		use_bf = make_uniq<LogicalUseBF>(v);
-		use_bf->has_estimated_cardinality = true;
-		use_bf->estimated_cardinality = node.estimated_cardinality;
+		filters.emplace_back(temp_result_to_use[i]);
 		auto idx = depend_nodes[i];
 		auto base_node = dag_manager.nodes_manager.getNode(idx);
+		LogicalOperator *related_bf_create;
 		if (!reverse) {
-			auto related_bf_create = replace_map_forward[base_node].get();
-			if(related_bf_create->type == LogicalOperatorType::LOGICAL_CREATE_BF) {
-				use_bf->AddDownStreamOperator((LogicalCreateBF*)related_bf_create);
-			} else {
-				D_ASSERT(false);
-			}
+			related_bf_create = replace_map_forward[base_node].get();
 		} else {
-			auto related_bf_create = replace_map_backward[base_node].get();
-			if(related_bf_create->type == LogicalOperatorType::LOGICAL_CREATE_BF) {
-				use_bf->AddDownStreamOperator((LogicalCreateBF*)related_bf_create);
-			} else {
-				D_ASSERT(false);
-			}
+			related_bf_create = replace_map_backward[base_node].get();
 		}
-		if (pre_use_bf != nullptr) {
-			use_bf->AddChild(std::move(pre_use_bf));
+		if(related_bf_create->type == LogicalOperatorType::LOGICAL_CREATE_BF) {
+			auto create_bf = (LogicalCreateBF*)related_bf_create;
+			if (std::find(related_create_bfs.begin(), related_create_bfs.end(), create_bf) == related_create_bfs.end()) {
+				related_create_bfs.emplace_back(create_bf);
+			}
+		} else {
+			D_ASSERT(false);
 		}
-		pre_use_bf = std::move(use_bf);
 	}
-	return pre_use_bf;
+	auto use_bf = make_uniq<LogicalUseBF>(filters);
+	use_bf->has_estimated_cardinality = true;
+	use_bf->estimated_cardinality = node.estimated_cardinality;
+	for (auto create_bf : related_create_bfs) {
+		use_bf->AddDownStreamOperator(create_bf);
+	}
+	return use_bf;
 }
 
-#ifdef UseHashFilter
-unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<HashFilter>> &temp_result_to_use, vector<shared_ptr<HashFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse) {
-#else
-unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_use, vector<shared_ptr<BlockedBloomFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse) {
-#endif
+unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildCreateUsePair(LogicalOperator &node, vector<shared_ptr<TransferFilter>> &temp_result_to_use, vector<shared_ptr<TransferFilter>> &temp_result_to_create, vector<idx_t> &depend_nodes, bool reverse) {
 	auto use_bf = BuildUseOperator(node, temp_result_to_use, depend_nodes, reverse);
 	auto create_bf = make_uniq<LogicalCreateBF>(temp_result_to_create);
 	create_bf->AddChild(unique_ptr_cast<LogicalUseBF, LogicalOperator>(std::move(use_bf)));
@@ -351,6 +377,69 @@ unique_ptr<LogicalCreateBF> PredicateTransferOptimizer::BuildCreateUsePair(Logic
 	return create_bf;
 }
 
+/* Apply the plain column filters of a UseBF on top of a set operation in each of its input branches instead, where
+ * they can reach the scans. A row passes a filter by the values of its key columns only, so filtering the inputs of a
+ * UNION, INTERSECT or EXCEPT gives the same result as filtering its output */
+void PredicateTransferOptimizer::PushUseIntoBranches(LogicalUseBF &use_bf, LogicalOperator &set_operation) {
+	auto set_operation_index = set_operation.Cast<LogicalSetOperation>().table_index;
+	vector<shared_ptr<TransferFilter>> branch_filters;
+	vector<shared_ptr<TransferFilter>> remaining;
+	for (auto &filter : use_bf.bf_to_use) {
+		// expression keys read the columns of the set operation, they are evaluated on top of it
+		if (filter->expressions_applied_.empty()) {
+			branch_filters.emplace_back(filter);
+		} else {
+			remaining.emplace_back(filter);
+		}
+	}
+	if (branch_filters.empty()) {
+		return;
+	}
+	for (auto &child : set_operation.children) {
+		auto branch_use = make_uniq<LogicalUseBF>(branch_filters);
+		branch_use->set_operation_index = set_operation_index;
+		branch_use->related_create_bf = use_bf.related_create_bf;
+		branch_use->has_estimated_cardinality = true;
+		branch_use->estimated_cardinality = child->estimated_cardinality;
+		branch_use->AddChild(std::move(child));
+		child = std::move(branch_use);
+	}
+	use_bf.bf_to_use = std::move(remaining);
+}
+
+/* Put `plan` below the CreateBF/UseBF chain that replaces it */
+unique_ptr<LogicalOperator> PredicateTransferOptimizer::AttachBelowChain(unique_ptr<LogicalOperator> chain,
+                                                                         unique_ptr<LogicalOperator> plan) {
+	LogicalOperator *parent = nullptr;
+	auto ptr = chain.get();
+	while (ptr->children.size() != 0) {
+		parent = ptr;
+		ptr = ptr->children[0].get();
+	}
+	switch (plan->type) {
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT:
+		if (ptr->type == LogicalOperatorType::LOGICAL_USE_BF) {
+			auto &use_bf = ptr->Cast<LogicalUseBF>();
+			PushUseIntoBranches(use_bf, *plan);
+			if (use_bf.bf_to_use.empty()) {
+				// the branches carry the dependencies on the CreateBF pipelines now
+				if (!parent) {
+					return plan;
+				}
+				parent->children[0] = std::move(plan);
+				return chain;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+	ptr->AddChild(std::move(plan));
+	return chain;
+}
+
 /* Insert CreateBF into the plan */
 unique_ptr<LogicalOperator> PredicateTransferOptimizer::InsertCreateBFOperator(unique_ptr<LogicalOperator> plan) {
 	for(auto &child : plan->children) {
@@ -359,12 +448,7 @@ unique_ptr<LogicalOperator> PredicateTransferOptimizer::InsertCreateBFOperator(u
 	void *plan_ptr = plan.get();
 	auto itr = replace_map_forward.find(plan_ptr);
 	if (itr != replace_map_forward.end()) {
-		auto ptr = itr->second.get();
-		while (ptr->children.size() != 0) {
-			ptr = ptr->children[0].get();
-		}
-		ptr->AddChild(std::move(plan));
-		return std::move(itr->second);
+		return AttachBelowChain(std::move(itr->second), std::move(plan));
 	} else {
 		return plan;
 	}
@@ -384,23 +468,13 @@ unique_ptr<LogicalOperator> PredicateTransferOptimizer::InsertCreateBFOperator_d
 	if (itr != replace_map_forward.end()) {
 		std::cout << "Find in forward!" << std::endl;
 		insert_create_table = true;
-		auto ptr = itr->second.get();
-		while (ptr->children.size() != 0) {
-			ptr = ptr->children[0].get();
-		}
-		ptr->AddChild(std::move(plan));
-		plan = std::move(itr->second);
+		plan = AttachBelowChain(std::move(itr->second), std::move(plan));
 	}
 	auto itr_next = replace_map_backward.find(plan_ptr);
 	if (itr_next != replace_map_backward.end()) {
 		std::cout << "Find in backward!" << std::endl;
 		insert_create_table = true;
-		auto ptr_next = itr_next->second.get();
-		while (ptr_next->children.size() != 0) {
-			ptr_next = ptr_next->children[0].get();
-		}
-		ptr_next->AddChild(std::move(plan));
-		plan = std::move(itr_next->second);
+		plan = AttachBelowChain(std::move(itr_next->second), std::move(plan));
 	}
 	/*
 	if (insert_create_table) {
@@ -410,33 +484,6 @@ unique_ptr<LogicalOperator> PredicateTransferOptimizer::InsertCreateBFOperator_d
 	return plan;
 }
 
-/* Will this node be filtered? */
-bool PredicateTransferOptimizer::PossibleFilterAny(LogicalOperator &node, bool reverse) {
-	return true;
-	if(!reverse) {
-		if (node.type == LogicalOperatorType::LOGICAL_GET) {
-			auto& get = node.Cast<LogicalGet>();
-			if(get.table_filters.filters.size() == 0) {
-				return false;
-			}
-		} else if (node.type == LogicalOperatorType::LOGICAL_UNION) {
-			return false;
-		}
-	} else {
-		if (replace_map_forward.find(&node) == replace_map_forward.end()) {
-			if (node.type == LogicalOperatorType::LOGICAL_GET) {
-				auto& get = node.Cast<LogicalGet>();
-				if (get.table_filters.filters.size() == 0) {
-					return false;
-				}
-			} else if (node.type == LogicalOperatorType::LOGICAL_UNION) {
-				return false;
-			}
-		}
-	}
-	return true;
-}
-
 // /* Only for microbenchmark */
 // unique_ptr<LogicalOperator> PredicateTransferOptimizer::InsertCreateTable(unique_ptr<LogicalOperator> plan, LogicalOperator* plan_ptr) {
 // 	if(plan_ptr->type != LogicalOperatorType::LOGICAL_GET && plan_ptr->type != LogicalOperatorType::LOGICAL_FILTER) {
@@ -0,0 +1,50 @@
+#include "duckdb/optimizer/predicate_transfer/range_filter.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+void RangeFilter::Select(Vector &keys, const SelectionVector *sel, idx_t count,
+                         SelectionVector &result, idx_t &result_count) const {
+  if (empty_) {
+    // no build key at all: no row finds a partner
+    result_count = 0;
+    return;
+  }
+  Value bound = Bound();
+  if (!bound.IsNull() && bound.type() != keys.GetType() &&
+      !bound.DefaultTryCastAs(keys.GetType())) {
+    bound = Value();
+  }
+  if (bound.IsNull()) {
+    // no bound (e.g. keys without min/max statistics): every row may find a partner
+    for (idx_t i = 0; i < count; i++) {
+      result.set_index(i, sel ? sel->get_index(i) : i);
+    }
+    result_count = count;
+    return;
+  }
+  Vector constant(bound);
+  // the comparisons read the i-th key and emit sel[i]: the keys must be
+  // sliced to the rows of `sel` first
+  Vector selected(keys);
+  if (sel) {
+    selected.Slice(*sel, count);
+  }
+  switch (comparison_) {
+    case ExpressionType::COMPARE_GREATERTHAN:
+      result_count = VectorOperations::GreaterThan(selected, constant, sel, count, &result, nullptr);
+      break;
+    case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+      result_count = VectorOperations::GreaterThanEquals(selected, constant, sel, count, &result, nullptr);
+      break;
+    case ExpressionType::COMPARE_LESSTHAN:
+      result_count = VectorOperations::LessThan(selected, constant, sel, count, &result, nullptr);
+      break;
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+      result_count = VectorOperations::LessThanEquals(selected, constant, sel, count, &result, nullptr);
+      break;
+    default:
+      throw InternalException("RangeFilter: unsupported comparison");
+  }
+}
+}
@@ -0,0 +1,128 @@
+#include "duckdb/optimizer/predicate_transfer/transfer_cost_model.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/main/client_config.hpp"
+
+namespace duckdb {
+
+TransferCostModel::NodeEstimate &TransferCostModel::GetEstimate(idx_t node) {
+	auto entry = node_estimates.find(node);
+	if (entry != node_estimates.end()) {
+		return entry->second;
+	}
+	auto &estimate = node_estimates[node];
+	auto op = nodes_manager.getNode(node);
+	if (!op) {
+		return estimate;
+	}
+	// Filters that could not be pushed into the scan get the default selectivity
+	auto scan = op;
+	double selectivity = 1;
+	if (op->type == LogicalOperatorType::LOGICAL_FILTER && op->children[0]->type == LogicalOperatorType::LOGICAL_GET) {
+		scan = op->children[0].get();
+		selectivity = RelationStatisticsHelper::DEFAULT_SELECTIVITY;
+	}
+	if (scan->type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = scan->Cast<LogicalGet>();
+		// ExtractGetStats starts from, and overwrites, the estimate of the get
+		auto estimated_cardinality = get.estimated_cardinality;
+		auto has_estimated_cardinality = get.has_estimated_cardinality;
+		get.has_estimated_cardinality = false;
+		estimate.base_cardinality = double(get.EstimateCardinality(context));
+		auto stats = RelationStatisticsHelper::ExtractGetStats(get, context);
+		get.estimated_cardinality = estimated_cardinality;
+		get.has_estimated_cardinality = has_estimated_cardinality;
+
+		estimate.cardinality = double(stats.cardinality) * selectivity;
+		for (idx_t i = 0; i < stats.column_distinct_count.size(); i++) {
+			auto distinct_count = stats.column_distinct_count[i].distinct_count;
+			if (distinct_count > 0) {
+				estimate.distinct[i] = double(distinct_count);
+			}
+		}
+	} else {
+		estimate.base_cardinality = double(op->estimated_cardinality);
+		estimate.cardinality = estimate.base_cardinality;
+	}
+	estimate.known = true;
+	return estimate;
+}
+
+double TransferCostModel::GetDistinct(idx_t node, const ColumnBinding &binding) {
+	auto &estimate = GetEstimate(node);
+	if (binding.table_index != node) {
+		return estimate.cardinality;
+	}
+	auto entry = estimate.distinct.find(binding.column_index);
+	if (entry == estimate.distinct.end()) {
+		return estimate.cardinality;
+	}
+	return MinValue(entry->second, estimate.cardinality);
+}
+
+bool TransferCostModel::IsBeneficial(idx_t build_node, idx_t probe_node, TransferFilter &filter) {
+	auto &build = GetEstimate(build_node);
+	auto &probe = GetEstimate(probe_node);
+	auto &built = filter.column_bindings_built_;
+	auto &applied = filter.column_bindings_applied_;
+	D_ASSERT(built.size() == applied.size());
+
+	FilterEstimate result;
+	double selectivity = 1;
+	if (filter.GetFilterType() == TransferFilterType::RANGE_FILTER) {
+		// A bound of the build keys only cuts off probe rows once the build side is reduced,
+		// assume it cuts off as much as the build side lost
+		if (build.base_cardinality > 0) {
+			selectivity = MaxValue(build.cardinality / build.base_cardinality, RelationStatisticsHelper::DEFAULT_SELECTIVITY);
+			selectivity = MinValue(selectivity, 1.0);
+		}
+	} else {
+		// A probe key passes if the build side has it: the fraction of probe keys covered by build keys,
+		// taken over the most selective column of a multi-column filter
+		for (idx_t i = 0; i < built.size(); i++) {
+			auto build_distinct = GetDistinct(build_node, built[i]);
+			auto probe_distinct = GetDistinct(probe_node, applied[i]);
+			result.build_distinct.push_back(build_distinct);
+			if (probe_distinct > 0) {
+				selectivity = MinValue(selectivity, build_distinct / probe_distinct);
+			}
+		}
+	}
+	if (build.cardinality <= 0) {
+		selectivity = 0;
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	if (filter.GetFilterType() == TransferFilterType::BLOOM_FILTER) {
+		selectivity += (1 - selectivity) * config.transfer_false_positive_rate;
+	}
+	result.selectivity = selectivity;
+	filter_estimates[&filter] = std::move(result);
+
+	if (!build.known || !probe.known) {
+		return true;
+	}
+	// Building hashes and materializes every build row, probing hashes every probe row
+	double removed = probe.cardinality * (1 - selectivity);
+	double cost = build.cardinality + probe.cardinality;
+	return removed >= config.transfer_min_benefit * cost;
+}
+
+void TransferCostModel::ApplyFilters(idx_t node, const vector<shared_ptr<TransferFilter>> &filters) {
+	for (auto &filter : filters) {
+		auto entry = filter_estimates.find(filter.get());
+		if (entry == filter_estimates.end()) {
+			continue;
+		}
+		auto &filter_estimate = entry->second;
+		auto &applied = filter->column_bindings_applied_;
+		for (idx_t i = 0; i < filter_estimate.build_distinct.size(); i++) {
+			if (applied[i].table_index != node) {
+				continue;
+			}
+			auto distinct = GetDistinct(node, applied[i]);
+			GetEstimate(node).distinct[applied[i].column_index] =
+			    MinValue(distinct, filter_estimate.build_distinct[i]);
+		}
+		GetEstimate(node).cardinality *= filter_estimate.selectivity;
+	}
+}
+} // namespace duckdb
@@ -0,0 +1,173 @@
+#include "duckdb/optimizer/predicate_transfer/transfer_key_hash.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+// The hash of a NULL key and the factor combining two hashes, as in
+// vector_hash.cpp
+static constexpr hash_t kNullHash = 0xbf58476d1ce4e5b9;
+
+static inline hash_t CombineKeyHash(hash_t a, hash_t b) {
+  return (a * UINT64_C(0xbf58476d1ce4e5b9)) ^ b;
+}
+
+// duckdb::Hash, inlined
+static inline hash_t KeyHash(int32_t key) {
+  return murmurhash32(uint32_t(key));
+}
+
+static inline hash_t KeyHash(int64_t key) {
+  return murmurhash64(uint64_t(key));
+}
+
+template <class T>
+static inline hash_t KeyHash(const UnifiedVectorFormat &vdata, idx_t row) {
+  auto idx = vdata.sel->get_index(row);
+  if (!vdata.validity.RowIsValid(idx)) {
+    return kNullHash;
+  }
+  return KeyHash(UnifiedVectorFormat::GetData<T>(vdata)[idx]);
+}
+
+template <bool HAS_SEL, class A>
+static void FusedHash(const UnifiedVectorFormat &a, const SelectionVector *sel, idx_t count,
+                      hash_t *__restrict hashes) {
+  if (a.validity.AllValid()) {
+    auto a_data = UnifiedVectorFormat::GetData<A>(a);
+    for (idx_t i = 0; i < count; i++) {
+      auto row = HAS_SEL ? sel->get_index(i) : i;
+      hashes[row] = KeyHash(a_data[a.sel->get_index(row)]);
+    }
+    return;
+  }
+  for (idx_t i = 0; i < count; i++) {
+    auto row = HAS_SEL ? sel->get_index(i) : i;
+    hashes[row] = KeyHash<A>(a, row);
+  }
+}
+
+template <bool HAS_SEL, class A, class B>
+static void FusedHash(const UnifiedVectorFormat &a, const UnifiedVectorFormat &b, const SelectionVector *sel,
+                      idx_t count, hash_t *__restrict hashes) {
+  if (a.validity.AllValid() && b.validity.AllValid()) {
+    auto a_data = UnifiedVectorFormat::GetData<A>(a);
+    auto b_data = UnifiedVectorFormat::GetData<B>(b);
+    for (idx_t i = 0; i < count; i++) {
+      auto row = HAS_SEL ? sel->get_index(i) : i;
+      hashes[row] = CombineKeyHash(KeyHash(a_data[a.sel->get_index(row)]), KeyHash(b_data[b.sel->get_index(row)]));
+    }
+    return;
+  }
+  for (idx_t i = 0; i < count; i++) {
+    auto row = HAS_SEL ? sel->get_index(i) : i;
+    hashes[row] = CombineKeyHash(KeyHash<A>(a, row), KeyHash<B>(b, row));
+  }
+}
+
+template <class A>
+static void FusedHash(const UnifiedVectorFormat &a, const SelectionVector *sel, idx_t count, hash_t *hashes) {
+  if (sel) {
+    FusedHash<true, A>(a, sel, count, hashes);
+  } else {
+    FusedHash<false, A>(a, sel, count, hashes);
+  }
+}
+
+template <class A, class B>
+static void FusedHash(const UnifiedVectorFormat &a, const UnifiedVectorFormat &b, const SelectionVector *sel,
+                      idx_t count, hash_t *hashes) {
+  if (sel) {
+    FusedHash<true, A, B>(a, b, sel, count, hashes);
+  } else {
+    FusedHash<false, A, B>(a, b, sel, count, hashes);
+  }
+}
+
+static bool IsFusedKeyType(const Vector &column) {
+  auto type = column.GetType().InternalType();
+  return type == PhysicalType::INT32 || type == PhysicalType::INT64;
+}
+
+bool TransferKeyHash::HashFused(Vector &first, Vector *second, const SelectionVector *sel, idx_t count,
+                                Vector &hashes) {
+  if (!IsFusedKeyType(first) || (second && !IsFusedKeyType(*second))) {
+    return false;
+  }
+  hashes.SetVectorType(VectorType::FLAT_VECTOR);
+  auto hash_data = FlatVector::GetData<hash_t>(hashes);
+  UnifiedVectorFormat a;
+  first.ToUnifiedFormat(count, a);
+  bool a_64 = first.GetType().InternalType() == PhysicalType::INT64;
+  if (!second) {
+    if (a_64) {
+      FusedHash<int64_t>(a, sel, count, hash_data);
+    } else {
+      FusedHash<int32_t>(a, sel, count, hash_data);
+    }
+    return true;
+  }
+  UnifiedVectorFormat b;
+  second->ToUnifiedFormat(count, b);
+  bool b_64 = second->GetType().InternalType() == PhysicalType::INT64;
+  if (a_64 && b_64) {
+    FusedHash<int64_t, int64_t>(a, b, sel, count, hash_data);
+  } else if (a_64) {
+    FusedHash<int64_t, int32_t>(a, b, sel, count, hash_data);
+  } else if (b_64) {
+    FusedHash<int32_t, int64_t>(a, b, sel, count, hash_data);
+  } else {
+    FusedHash<int32_t, int32_t>(a, b, sel, count, hash_data);
+  }
+  return true;
+}
+
+void TransferKeyHash::Flatten(const SelectionVector *sel, idx_t count, Vector &hashes) {
+  if (hashes.GetVectorType() != VectorType::CONSTANT_VECTOR) {
+    return;
+  }
+  // constant keys: spread the hash over the rows, in place
+  auto hash = *ConstantVector::GetData<hash_t>(hashes);
+  hashes.SetVectorType(VectorType::FLAT_VECTOR);
+  auto data = FlatVector::GetData<hash_t>(hashes);
+  for (idx_t i = 0; i < count; i++) {
+    data[sel ? sel->get_index(i) : i] = hash;
+  }
+}
+
+void TransferKeyHash::Hash(Vector &keys, const SelectionVector *sel, idx_t count, Vector &hashes) {
+  if (HashFused(keys, nullptr, sel, count, hashes)) {
+    return;
+  }
+  if (sel) {
+    VectorOperations::Hash(keys, hashes, *sel, count);
+  } else {
+    VectorOperations::Hash(keys, hashes, count);
+  }
+  Flatten(sel, count, hashes);
+}
+
+void TransferKeyHash::Hash(vector<Vector> &columns, const vector<idx_t> &cols, const SelectionVector *sel,
+                           idx_t count, Vector &hashes) {
+  D_ASSERT(!cols.empty());
+  if (cols.size() == 1) {
+    Hash(columns[cols[0]], sel, count, hashes);
+    return;
+  }
+  if (cols.size() == 2 && HashFused(columns[cols[0]], &columns[cols[1]], sel, count, hashes)) {
+    return;
+  }
+  if (sel) {
+    VectorOperations::Hash(columns[cols[0]], hashes, *sel, count);
+    for (idx_t i = 1; i < cols.size(); i++) {
+      VectorOperations::CombineHash(hashes, columns[cols[i]], *sel, count);
+    }
+  } else {
+    VectorOperations::Hash(columns[cols[0]], hashes, count);
+    for (idx_t i = 1; i < cols.size(); i++) {
+      VectorOperations::CombineHash(hashes, columns[cols[i]], count);
+    }
+  }
+  Flatten(sel, count, hashes);
+}
+}
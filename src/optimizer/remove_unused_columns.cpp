@@ -22,6 +22,18 @@
 
 namespace duckdb {
 
+//! Whether predicate transfer filters the input branches of the set operation. The branch UseBFs probe the columns
+//! of the set operation by position, so no branch may lose a column.
+static bool HasBranchFilters(LogicalSetOperation &setop) {
+	for (auto &child : setop.children) {
+		if (child->type == LogicalOperatorType::LOGICAL_USE_BF &&
+		    child->Cast<LogicalUseBF>().set_operation_index == setop.table_index) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void RemoveUnusedColumns::ReplaceBinding(ColumnBinding current_binding, ColumnBinding new_binding) {
 	auto colrefs = column_references.find(current_binding);
 	if (colrefs != column_references.end()) {
@@ -111,7 +123,7 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 	case LogicalOperatorType::LOGICAL_ANY_JOIN:
 		break;
 	case LogicalOperatorType::LOGICAL_UNION:
-		if (!everything_referenced) {
+		if (!everything_referenced && !HasBranchFilters(op.Cast<LogicalSetOperation>())) {
 			// for UNION we can remove unreferenced columns as long as everything_referenced is false (i.e. we
 			// encounter a UNION node that is not preceded by a DISTINCT)
 			// this happens when UNION ALL is used
@@ -0,0 +1,140 @@
+#include "duckdb/planner/filter/transfer_table_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/adaptive_transfer_filter.hpp"
+#include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter_use_kernel.hpp"
+#include "duckdb/optimizer/predicate_transfer/hash_filter/hash_filter_use_kernel.hpp"
+#include "duckdb/optimizer/predicate_transfer/range_filter.hpp"
+#include "duckdb/optimizer/predicate_transfer/transfer_key_hash.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+
+namespace duckdb {
+
+TransferTableFilter::TransferTableFilter(shared_ptr<TransferFilter> filter_p)
+    : TableFilter(TableFilterType::TRANSFER_FILTER), filter(std::move(filter_p)) {
+}
+
+void TransferTableFilter::Filter(Vector &keys, SelectionVector &sel, idx_t &approved_tuple_count) const {
+	if (!filter->IsReady() || filter->IsSwitchedOff()) {
+		return;
+	}
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	if (filter->HasExactKeys()) {
+		filter->ExactKeys().Select(keys, &sel, approved_tuple_count, result_sel, result_count);
+	} else if (filter->GetFilterType() == TransferFilterType::HASH_FILTER) {
+		DataChunk key_chunk;
+		key_chunk.data.emplace_back(keys);
+		HashFilterUseKernel::filter(key_chunk, filter->Cast<HashFilter>(), &sel, approved_tuple_count, result_sel,
+		                            result_count);
+	} else if (filter->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+		filter->Cast<RangeFilter>().Select(keys, &sel, approved_tuple_count, result_sel, result_count);
+	} else {
+		// the hashes live on the stack, a table filter has no state to keep a buffer in
+		hash_t hash_buffer[STANDARD_VECTOR_SIZE];
+		Vector hashes(LogicalType::HASH, data_ptr_cast(hash_buffer));
+		TransferKeyHash::Hash(keys, &sel, approved_tuple_count, hashes);
+		BloomFilterUseKernel::filter(FlatVector::GetData<hash_t>(hashes), filter->Cast<BlockedBloomFilter>(), &sel,
+		                             approved_tuple_count, result_sel, result_count);
+	}
+	// the scan threads share the pass rate, a filter that removes hardly any row is not worth hashing the keys for
+	filter->RecordProbe(approved_tuple_count, result_count, AdaptiveTransferFilter::DISABLE_MIN_ROWS,
+	                    AdaptiveTransferFilter::DISABLE_PASS_RATE);
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
+unique_ptr<TableFilter> TransferTableFilter::Copy() {
+	return make_uniq<TransferTableFilter>(filter);
+}
+
+//! Whether a comparison of the zonemap in `stats` with `constant` can never be true
+static bool ZonemapAlwaysFalse(BaseStatistics &stats, ExpressionType comparison_type, const Value &constant) {
+	if (constant.type() != stats.GetType()) {
+		return false;
+	}
+	FilterPropagateResult result;
+	switch (constant.type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		result = NumericStats::CheckZonemap(stats, comparison_type, constant);
+		break;
+	case PhysicalType::VARCHAR:
+		result = StringStats::CheckZonemap(stats, comparison_type, StringValue::Get(constant));
+		break;
+	default:
+		return false;
+	}
+	return result == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+FilterPropagateResult TransferTableFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter->IsReady()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (filter->isEmpty()) {
+		// the build side was empty: no row of this segment can pass
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	if (filter->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+		// the zonemap lies entirely beyond the bound of the build keys
+		auto &range = filter->Cast<RangeFilter>();
+		if (!range.Bound().IsNull() && ZonemapAlwaysFalse(stats, range.GetComparison(), range.Bound())) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (filter->HasKeyRange()) {
+		// the zonemap does not overlap [min, max] of the build keys
+		if (ZonemapAlwaysFalse(stats, ExpressionType::COMPARE_GREATERTHANOREQUALTO, filter->KeyMin()) ||
+		    ZonemapAlwaysFalse(stats, ExpressionType::COMPARE_LESSTHANOREQUALTO, filter->KeyMax())) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+	}
+	if (filter->HasKeyList()) {
+		// none of the (few) build keys falls into the zonemap
+		for (auto &key : filter->KeyList()) {
+			if (!ZonemapAlwaysFalse(stats, ExpressionType::COMPARE_EQUAL, key)) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string TransferTableFilter::ToString(const string &column_name) {
+	if (filter->GetFilterType() == TransferFilterType::HASH_FILTER) {
+		return column_name + " IN HASH_FILTER";
+	}
+	if (filter->GetFilterType() == TransferFilterType::RANGE_FILTER) {
+		return column_name + " " + ExpressionTypeToOperator(filter->Cast<RangeFilter>().GetComparison()) +
+		       " RANGE_FILTER";
+	}
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool TransferTableFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<TransferTableFilter>();
+	return other.filter == filter;
+}
+
+void TransferTableFilter::Serialize(Serializer &serializer) const {
+	throw InternalException("Shouldn't go here: TransferTableFilter::Serialize");
+}
+
+} // namespace duckdb
@@ -1,11 +1,7 @@
 #include "duckdb/planner/operator/logical_create_bf.hpp"
 
 namespace duckdb {
-#ifdef UseHashFilter
-LogicalCreateBF::LogicalCreateBF(vector<shared_ptr<HashFilter>> bf)
-#else
-LogicalCreateBF::LogicalCreateBF(vector<shared_ptr<BlockedBloomFilter>> bf)
-#endif
+LogicalCreateBF::LogicalCreateBF(vector<shared_ptr<TransferFilter>> bf)
 	: LogicalOperator(LogicalOperatorType::LOGICAL_CREATE_BF), bf_to_create(bf) {};
 
 void LogicalCreateBF::Serialize(Serializer &serializer) const {
@@ -1,11 +1,7 @@
 #include "duckdb/planner/operator/logical_use_bf.hpp"
 
 namespace duckdb {
-#ifdef UseHashFilter
-LogicalUseBF::LogicalUseBF(vector<shared_ptr<HashFilter>> bf) 
-#else
-LogicalUseBF::LogicalUseBF(vector<shared_ptr<BlockedBloomFilter>> bf) 
-#endif
+LogicalUseBF::LogicalUseBF(vector<shared_ptr<TransferFilter>> bf) 
     : LogicalOperator(LogicalOperatorType::LOGICAL_USE_BF), bf_to_use(bf) {};
 
 void LogicalUseBF::Serialize(Serializer &serializer) const {
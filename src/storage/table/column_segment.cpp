@@ -10,7 +10,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/data_pointer.hpp"
-#include "duckdb/optimizer/predicate_transfer/bloom_filter/bloom_filter_use_kernel.hpp"
+#include "duckdb/planner/filter/transfer_table_filter.hpp"
 
 #include <cstring>
 
@@ -373,6 +373,11 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 		}
 		return approved_tuple_count;
 	}
+	case TableFilterType::TRANSFER_FILTER: {
+		auto &transfer_filter = filter.Cast<TransferTableFilter>();
+		transfer_filter.Filter(result, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
 	case TableFilterType::CONSTANT_COMPARISON: {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
 		// the inplace loops take the result as the last parameter
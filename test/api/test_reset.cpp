@@ -58,6 +58,19 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"join_order_algorithm", {{"exact_left_deep", "random_bushy", "random_left_deep"}}},
+	    {"predicate_transfer_mode", {"bloom_join"}},
+	    {"predicate_transfer_bloom_join_filter", {"never"}},
+	    {"predicate_transfer_filter", {"hash"}},
+	    {"predicate_transfer_order", {"small_to_large"}},
+	    {"predicate_transfer_external", {Value(true)}},
+	    {"predicate_transfer_streaming_build", {Value(false)}},
+	    {"predicate_transfer_parallel_bloom_build", {Value(true)}},
+	    {"predicate_transfer_false_positive_rate", {Value::DOUBLE(0.001)}},
+	    {"predicate_transfer_prefetch_distance", {Value::UBIGINT(0)}},
+	    {"predicate_transfer_pipelined", {Value(true)}},
+	    {"predicate_transfer_min_benefit", {Value::DOUBLE(0.5)}},
+	    {"predicate_transfer_bloom_layout", {"sectorized"}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"default_secret_storage", {"custom_storage"}},